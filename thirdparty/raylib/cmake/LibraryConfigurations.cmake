@@ -97,6 +97,14 @@ elseif ("${PLATFORM}" MATCHES "SDL")
     set(PLATFORM_CPP "PLATFORM_DESKTOP_SDL")
     set(LIBS_PRIVATE SDL2::SDL2)
 
+elseif ("${PLATFORM}" MATCHES "Template")
+    # Headless by default: null graphics backend, no display or OpenGL libraries required
+    set(PLATFORM_CPP "PLATFORM_TEMPLATE")
+    if(NOT GRAPHICS)
+        set(GRAPHICS "GRAPHICS_API_NULL")
+    endif ()
+    set(LIBS_PRIVATE m pthread ${CMAKE_DL_LIBS})
+
 endif ()
 
 if (NOT ${OPENGL_VERSION} MATCHES "OFF")
@@ -114,6 +122,8 @@ if (NOT ${OPENGL_VERSION} MATCHES "OFF")
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
     elseif (${OPENGL_VERSION} MATCHES "ES 3.0")
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES3")
+    elseif (${OPENGL_VERSION} MATCHES "Null")
+        set(GRAPHICS "GRAPHICS_API_NULL")
     endif ()
     if (NOT "${SUGGESTED_GRAPHICS}" STREQUAL "" AND NOT "${SUGGESTED_GRAPHICS}" STREQUAL "${GRAPHICS}")
         message(WARNING "You are overriding the suggested GRAPHICS=${SUGGESTED_GRAPHICS} with ${GRAPHICS}! This may fail.")
@@ -52,6 +52,11 @@ int main(void)
     rlModelAnimation *anims = rlLoadModelAnimations("resources/models/iqm/guyanim.iqm", &animsCount);
     int animFrameCounter = 0;
 
+    // Animation pose, bones transforms for current frame
+    // NOTE: Poses are read with rlGetModelAnimationPose(), animation framePoses are NULL if animation is compressed
+    rlTransform *animPose = (rlTransform *)rlMemAlloc(anims[0].boneCount*sizeof(rlTransform));
+    rlGetModelAnimationPose(anims[0], 0.0f, animPose);
+
     rlDisableCursor();                    // Catch cursor
     rlSetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -69,6 +74,7 @@ int main(void)
             animFrameCounter++;
             rlUpdateModelAnimation(model, anims[0], animFrameCounter);
             if (animFrameCounter >= anims[0].frameCount) animFrameCounter = 0;
+            rlGetModelAnimationPose(anims[0], (float)animFrameCounter, animPose);
         }
         //----------------------------------------------------------------------------------
 
@@ -84,7 +90,7 @@ int main(void)
 
                 for (int i = 0; i < model.boneCount; i++)
                 {
-                    rlDrawCube(anims[0].framePoses[animFrameCounter][i].translation, 0.2f, 0.2f, 0.2f, RED);
+                    rlDrawCube(animPose[i].translation, 0.2f, 0.2f, 0.2f, RED);
                 }
 
                 rlDrawGrid(10, 1.0f);         // Draw a grid
@@ -101,6 +107,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadTexture(texture);                     // Unload texture
+    rlMemFree(animPose);                          // Unload animation pose
     rlUnloadModelAnimations(anims, animsCount);   // Unload model animations data
     rlUnloadModel(model);                         // Unload model
 
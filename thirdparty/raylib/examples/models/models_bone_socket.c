@@ -58,6 +58,10 @@ int main(void)
     unsigned int animCurrentFrame = 0;
     rlModelAnimation *modelAnimations = rlLoadModelAnimations("resources/models/gltf/greenman.glb", &animsCount);
 
+    // Animation pose, bones transforms for current frame
+    // NOTE: Poses are read with rlGetModelAnimationPose(), animation framePoses are NULL if animation is compressed
+    rlTransform *animPose = (rlTransform *)rlMemAlloc(characterModel.boneCount*sizeof(rlTransform));
+
     // indices of bones for sockets
     int boneSocketIndex[BONE_SOCKETS] = { -1, -1, -1 };
 
@@ -115,6 +119,7 @@ int main(void)
         rlModelAnimation anim = modelAnimations[animIndex];
         animCurrentFrame = (animCurrentFrame + 1)%anim.frameCount;
         rlUpdateModelAnimation(characterModel, anim, animCurrentFrame);
+        rlGetModelAnimationPose(anim, (float)animCurrentFrame, animPose);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -135,7 +140,7 @@ int main(void)
                 {
                     if (!showEquip[i]) continue;
 
-                    rlTransform *transform = &anim.framePoses[animCurrentFrame][boneSocketIndex[i]];
+                    rlTransform *transform = &animPose[boneSocketIndex[i]];
                     Quaternion inRotation = characterModel.bindPose[boneSocketIndex[i]].rotation;
                     Quaternion outRotation = transform->rotation;
                     
@@ -164,6 +169,7 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    rlMemFree(animPose);
     rlUnloadModelAnimations(modelAnimations, animsCount);
     rlUnloadModel(characterModel);         // Unload character model and meshes/material
     
@@ -54,6 +54,10 @@ int main(void)
     int animFrameCounter = 0, animId = 0;
     rlModelAnimation *anims = rlLoadModelAnimations(modelFileName, &animsCount); // Load skeletal animation data
 
+    // Animation pose, bones transforms for current frame
+    // NOTE: Poses are read with rlGetModelAnimationPose(), animation framePoses are NULL if animation is compressed
+    rlTransform *animPose = (rlTransform *)rlMemAlloc(model.boneCount*sizeof(rlTransform));
+
     rlDisableCursor();                    // Limit cursor to relative movement inside the window
 
     rlSetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
@@ -76,6 +80,7 @@ int main(void)
                 if (animFrameCounter >= anims[animId].frameCount) animFrameCounter = 0;
 
                 rlUpdateModelAnimation(model, anims[animId], animFrameCounter);
+                rlGetModelAnimationPose(anims[animId], (float)animFrameCounter, animPose);
                 animPlaying = true;
             }
 
@@ -87,6 +92,7 @@ int main(void)
 
                 if (animId >= (int)animsCount) animId = 0;
                 rlUpdateModelAnimation(model, anims[animId], 0);
+                rlGetModelAnimationPose(anims[animId], 0.0f, animPose);
                 animPlaying = true;
             }
         }
@@ -134,12 +140,11 @@ int main(void)
                         else
                         {
                             // Display the frame-pose skeleton
-                            rlDrawCube(anims[animId].framePoses[animFrameCounter][i].translation, 0.05f, 0.05f, 0.05f, RED);
+                            rlDrawCube(animPose[i].translation, 0.05f, 0.05f, 0.05f, RED);
 
                             if (anims[animId].bones[i].parent >= 0)
                             {
-                                rlDrawLine3D(anims[animId].framePoses[animFrameCounter][i].translation,
-                                    anims[animId].framePoses[animFrameCounter][anims[animId].bones[i].parent].translation, RED);
+                                rlDrawLine3D(animPose[i].translation, animPose[anims[animId].bones[i].parent].translation, RED);
                             }
                         }
                     }
@@ -164,6 +169,7 @@ int main(void)
 
     // Unload model animations data
     rlUnloadModelAnimations(anims, animsCount);
+    rlMemFree(animPose);
 
     rlUnloadModel(model);         // Unload model
 
@@ -66,6 +66,12 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support profiler: CPU and GPU profiling scopes, timeline overlay and Chrome trace export
+// NOTE: Profiler is disabled by default, rlEnableProfiler() starts recording
+#define SUPPORT_PROFILER                1
+// Support job system initialization on rlInitWindow(): work-stealing worker threads, one per processor
+// NOTE: Library batch functions (rlParallelFor()) and async loading run jobs on it, user code can submit jobs too
+#define SUPPORT_JOB_SYSTEM              1
 // Support custom frame control, only for advanced users
 // By default rlEndDrawing() does this job: draws everything + rlSwapScreenBuffer() + manage frame timing + rlPollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -90,6 +96,11 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_PROFILER_FRAMES           120       // Maximum number of frames kept by profiler (trace export)
+#define MAX_PROFILER_SCOPES           256       // Maximum number of profiling scopes per frame
+#define MAX_PROFILER_GPU_SCOPES        32       // Maximum number of GPU profiling scopes per frame
+#define MAX_PROFILER_SCOPE_DEPTH       32       // Maximum profiling scopes nesting depth
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -188,6 +199,14 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: rlImageFormat(), rlImageCrop(), rlImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support instanced sprites drawing for rlDrawTexturePro(), quads generated on GPU (requires instancing support)
+// WARNING: Render batch and sprite batch are drawn on every switch between sprites and other shapes drawing,
+// only recommended for scenes drawing long runs of sprites
+//#define SUPPORT_SPRITE_INSTANCING       1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define IMAGE_PARALLEL_MIN_PIXELS  262144       // Minimum image pixels count to process image rows in parallel on job system (512x512)
 
 
 //------------------------------------------------------------------------------------
@@ -227,9 +246,18 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+// Support raylib binary model format (.rmdl), cooked with rlExportModel() and loaded with no parsing
+#define SUPPORT_FILEFORMAT_RMDL         1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Compress loaded animations keyframes: quantized rotations, constant tracks removal and keyframes reduction
+// NOTE: Animations framePoses are replaced by compressed keys, sampled on animation update,
+// framePoses are NULL for loaded animations, poses must be read with rlGetModelAnimationPose()
+//#define SUPPORT_ANIMATION_COMPRESSION   1
+// Keep glTF animations channels keyframes and sample them on animation update instead of baking every frame
+// NOTE: Loaded glTF animations framePoses are NULL, poses must be read with rlGetModelAnimationPose()
+//#define SUPPORT_GLTF_ANIMATION_KEYS     1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
@@ -240,6 +268,14 @@
 #else
 #define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
 #endif
+#define MAX_INSTANCE_ATTRIBUTES         4       // Maximum custom attributes per instance buffer
+#define MESH_BVH_LEAF_TRIANGLES         4       // Maximum triangles per mesh BVH leaf node
+#define MESH_BVH_MAX_DEPTH             48       // Maximum mesh BVH depth, deeper nodes become leaves
+#define RAY_PACKET_SIZE                 8       // Rays tested together by batch collision functions (SIMD lanes: 4 or 8)
+#define AABB_TREE_STACK_SIZE          256       // Dynamic bounding box tree queries traversal stack size (tree is balanced)
+#define SKINNING_BLOCK_SIZE            64       // Vertices skinned per block by CPU skinning (jobs split mesh in blocks)
+#define ANIMATION_COMPRESSION_TOLERANCE 0.0005f // Maximum pose error of loaded animations compressed keyframes
+#define ANIMATION_KEYS_MAX_SPAN        64       // Maximum frames between compressed animation keys
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -274,5 +310,6 @@
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_JOB_WORKERS                16       // Maximum job system worker threads (jobs, parallel-for and async models loading)
 
 #endif // CONFIG_H
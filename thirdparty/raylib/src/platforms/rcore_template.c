@@ -4,6 +4,7 @@
 *
 *   PLATFORM: <PLATFORM>
 *       - TODO: Define the target platform for the core
+*       - Headless (PLATFORM_TEMPLATE + GRAPHICS_API_NULL): No display, no GPU, rlgl commands recorded
 *
 *   LIMITATIONS:
 *       - Limitation 01
@@ -20,6 +21,10 @@
 *       #define RCORE_PLATFORM_CUSTOM_FLAG
 *           Custom flag for rcore on target platform -not used-
 *
+*       #define RCORE_HEADLESS_FRAMES
+*           Number of frames run before rlWindowShouldClose() returns true on headless mode (GRAPHICS_API_NULL),
+*           allows running unmodified programs for benchmarking, 0 means no frames limit (default: 0)
+*
 *   DEPENDENCIES:
 *       - <platform-specific SDK dependency>
 *       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
@@ -48,17 +53,26 @@
 
 // TODO: Include the platform specific libraries
 
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RCORE_HEADLESS_FRAMES
+    #define RCORE_HEADLESS_FRAMES       0       // Frames run on headless mode before closing, 0 means no limit
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 typedef struct {
     // TODO: Define the platform specific variables required
 
+#if !defined(GRAPHICS_API_NULL)
     // Display data
     EGLDisplay device;                  // Native display device (physical screen connection)
     EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -66,7 +80,9 @@ typedef struct {
 //----------------------------------------------------------------------------------
 extern CoreData CORE;                   // Global CORE state context
 
+#if !defined(GRAPHICS_API_NULL)
 static PlatformData platform = { 0 };   // Platform specific data
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -86,6 +102,11 @@ bool InitGraphicsDevice(void);   // Initialize graphics device
 // Check if application should close
 bool rlWindowShouldClose(void)
 {
+#if defined(GRAPHICS_API_NULL) && (RCORE_HEADLESS_FRAMES > 0)
+    // Headless mode, close after the required number of frames
+    if (CORE.Time.frameCounter >= RCORE_HEADLESS_FRAMES) CORE.Window.shouldClose = true;
+#endif
+
     if (CORE.Window.ready) return CORE.Window.shouldClose;
     else return true;
 }
@@ -325,7 +346,9 @@ void rlDisableCursor(void)
 // Swap back buffer with front buffer (screen drawing)
 void rlSwapScreenBuffer(void)
 {
+#if !defined(GRAPHICS_API_NULL)
     eglSwapBuffers(platform.device, platform.surface);
+#endif
 }
 
 //----------------------------------------------------------------------------------
@@ -443,6 +466,16 @@ int InitPlatform(void)
     // raylib uses OpenGL so, platform should create that kind of connection
     // Below example illustrates that process using EGL library
     //----------------------------------------------------------------------------
+#if defined(GRAPHICS_API_NULL)
+    // Headless mode: No display and no graphics context required,
+    // rlgl null backend records OpenGL commands instead of issuing them
+    CORE.Window.ready = true;
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Headless mode, no display device initialized");
+#else
     CORE.Window.fullscreen = true;
     CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
 
@@ -545,6 +578,7 @@ int InitPlatform(void)
         TRACELOG(LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
         return -1;
     }
+#endif
     //----------------------------------------------------------------------------
 
     // If everything work as expected, we can continue
@@ -562,7 +596,11 @@ int InitPlatform(void)
     // TODO: Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
     //----------------------------------------------------------------------------
+#if defined(GRAPHICS_API_NULL)
+    rlLoadExtensions(NULL);     // Null backend provides its own OpenGL functions
+#else
     rlLoadExtensions(eglGetProcAddress);
+#endif
     //----------------------------------------------------------------------------
 
     // TODO: Initialize input events system
@@ -1863,6 +1863,10 @@ void rlUpdateMusicStream(rlMusic music)
 {
     if (music.stream.buffer == NULL) return;
 
+#if defined(SUPPORT_PROFILER)
+    rlBeginProfileScope("rlUpdateMusicStream");
+#endif
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -2011,12 +2015,19 @@ void rlUpdateMusicStream(rlMusic music)
                 ma_mutex_unlock(&AUDIO.System.lock);
                 // Streaming is ending, we filled latest frames from input
                 rlStopMusicStream(music);
+#if defined(SUPPORT_PROFILER)
+                rlEndProfileScope();
+#endif
                 return;
             }
         }
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
+
+#if defined(SUPPORT_PROFILER)
+    rlEndProfileScope();
+#endif
 }
 
 // Check if any music is playing
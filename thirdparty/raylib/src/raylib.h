@@ -362,6 +362,18 @@ typedef struct rlMesh {
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } rlMesh;
 
+// rlInstanceBuffer, per-instance data retained in GPU for instanced mesh drawing
+typedef struct rlInstanceBuffer {
+    int capacity;                   // Maximum number of instances stored
+    unsigned int transformsVboId;   // Instances transforms buffer (rlMatrix) (shader-location = SHADER_LOC_MATRIX_MODEL)
+    unsigned int colorsVboId;       // Instances colors buffer (rlColor), 0 if not used (shader-location = SHADER_LOC_VERTEX_INSTANCE_COLOR)
+
+    int attribCount;                // Number of custom per-instance attributes
+    unsigned int *attribVboId;      // Custom attributes buffers (float components)
+    int *attribComponents;          // Custom attributes components (1..4)
+    int *attribLocs;                // Custom attributes shader locations
+} rlInstanceBuffer;
+
 // rlShader
 typedef struct rlShader {
     unsigned int id;        // rlShader program id
@@ -411,15 +423,28 @@ typedef struct rlModel {
     rlTransform *bindPose;    // Bones base transformation (pose)
 } rlModel;
 
+// Compressed animation keyframes (opaque struct)
+// NOTE: Actual struct is defined internally in rmodels module
+typedef struct rlAnimationKeys rlAnimationKeys;
+
 // rlModelAnimation
 typedef struct rlModelAnimation {
     int boneCount;          // Number of bones
     int frameCount;         // Number of animation frames
     rlBoneInfo *bones;        // Bones information (skeleton)
-    rlTransform **framePoses; // Poses array by frame
+    rlTransform **framePoses; // Poses array by frame (NULL if animation uses keys, read poses with rlGetModelAnimationPose())
+    rlAnimationKeys *keys;  // Compressed keyframes (NULL if animation uses framePoses)
     char name[32];          // Animation name
 } rlModelAnimation;
 
+// rlAnimationLayer, animation blended into model pose
+typedef struct rlAnimationLayer {
+    rlModelAnimation animation; // Layer animation
+    float frame;                // Animation frame (fractional frames are interpolated, wraps around)
+    float weight;               // Layer blend weight [0..1]
+    const float *boneMask;      // Layer weight multiplier per bone [0..1] (NULL for all bones)
+} rlAnimationLayer;
+
 // rlRay, ray for raycasting
 typedef struct rlRay {
     rlVector3 position;       // rlRay position (origin)
@@ -440,6 +465,22 @@ typedef struct rlBoundingBox {
     rlVector3 max;            // Maximum vertex box-corner
 } rlBoundingBox;
 
+// rlMeshBVHNode, bounding volume hierarchy node
+typedef struct rlMeshBVHNode {
+    rlVector3 min;            // Node bounds minimum corner
+    int first;              // Leaf node: first triangle, inner node: left child node (right child is next node)
+    rlVector3 max;            // Node bounds maximum corner
+    int count;              // Leaf node: number of triangles, inner node: 0
+} rlMeshBVHNode;
+
+// rlMeshBVH, mesh triangles bounding volume hierarchy for ray queries (mesh space)
+typedef struct rlMeshBVH {
+    int nodeCount;          // Number of nodes (root is first node)
+    rlMeshBVHNode *nodes;     // Hierarchy nodes
+    int triangleCount;      // Number of triangles
+    float *triangles;       // Triangles vertex positions, ordered by leaf (XYZ - 9 components per triangle)
+} rlMeshBVH;
+
 // rlWave, audio wave data
 typedef struct rlWave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -454,6 +495,13 @@ typedef struct rlWave {
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
 
+// NOTE: Actual struct is defined internally in rshapes module
+typedef struct rlSpatialHash rlSpatialHash;
+
+// NOTE: Actual structs are defined internally in rmodels module
+typedef struct rlAABBTree rlAABBTree;
+typedef struct rlModelAsync rlModelAsync;
+
 // rlAudioStream, custom audio stream
 typedef struct rlAudioStream {
     rAudioBuffer *buffer;       // Pointer to internal data used by the audio system
@@ -526,6 +574,12 @@ typedef struct rlAutomationEventList {
     rlAutomationEvent *events;        // Events entries
 } rlAutomationEventList;
 
+// Job counter, jobs not done yet (use it to wait for jobs, init to 0)
+typedef struct rlJobCounter {
+    int value;                      // Jobs not done (modified atomically)
+    int queued;                     // Jobs queued, not taken yet (modified atomically)
+} rlJobCounter;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -795,7 +849,8 @@ typedef enum {
     SHADER_LOC_MAP_BRDF,            // rlShader location: sampler2d texture: brdf
     SHADER_LOC_VERTEX_BONEIDS,      // rlShader location: vertex attribute: boneIds
     SHADER_LOC_VERTEX_BONEWEIGHTS,  // rlShader location: vertex attribute: boneWeights
-    SHADER_LOC_BONE_MATRICES        // rlShader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_BONE_MATRICES,       // rlShader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_VERTEX_INSTANCE_COLOR // rlShader location: vertex attribute: instance color (rlInstanceBuffer)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -945,6 +1000,10 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*JobCallback)(void *data);                                // Jobs: Run job
+typedef void (*ParallelJobCallback)(void *data, int start, int end);    // Jobs: Process items range [start, end)
+typedef void (*ParallelForCallback)(ParallelJobCallback job, void *data, int count); // Jobs: Process items [0, count), split in ranges across workers, returns when all done
+typedef void (*ModelLoadedCallback)(rlModel model, void *userData);     // Models: Async model loaded and uploaded to GPU (model ownership is passed)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1104,6 +1163,17 @@ RLAPI void rlSetLoadFileDataCallback(LoadFileDataCallback callback); // Set cust
 RLAPI void rlSetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void rlSetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void rlSetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void rlSetParallelForCallback(ParallelForCallback callback);   // Set custom jobs dispatcher (used by batch functions, jobs run on job system by default)
+
+// Job system functions (work-stealing worker threads, shared by library and user code)
+// NOTE: Job system is initialized by rlInitWindow(), it can also be used standalone
+RLAPI void rlInitJobSystem(int workerCount);                        // Initialize job system worker threads (0 for one worker per processor, calling thread excluded)
+RLAPI void rlCloseJobSystem(void);                                  // Close job system (pending jobs are run first)
+RLAPI bool rlIsJobSystemReady(void);                                // Check if job system is initialized
+RLAPI int rlGetJobWorkerCount(void);                                // Get job system worker threads count
+RLAPI void rlRunJob(JobCallback job, void *data, rlJobCounter *counter); // Run job on job system, counter is incremented until job is done (optional)
+RLAPI void rlWaitJobCounter(rlJobCounter *counter);                 // Wait for counter jobs done, calling thread runs pending jobs of counter meanwhile
+RLAPI void rlParallelFor(ParallelJobCallback job, void *data, int count); // Process items [0, count) in ranges on job system, returns when all done
 
 // Files management functions
 RLAPI unsigned char *rlLoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
@@ -1155,6 +1225,18 @@ RLAPI void rlStartAutomationEventRecording(void);
 RLAPI void rlStopAutomationEventRecording(void);                                          // Stop recording automation events
 RLAPI void rlPlayAutomationEvent(rlAutomationEvent event);                                  // Play a recorded automation event
 
+// Profiling functionality
+// NOTE: By default, scopes recorded for drawing, render batch draws, buffers swap, frame wait and input events polling
+RLAPI void rlEnableProfiler(void);                                  // Enable profiler, CPU/GPU scopes recorded per frame (last MAX_PROFILER_FRAMES kept)
+RLAPI void rlDisableProfiler(void);                                 // Disable profiler, recorded frames are discarded
+RLAPI bool rlIsProfilerEnabled(void);                               // Check if profiler is enabled
+RLAPI void rlBeginProfileScope(const char *name);                   // Begin named CPU profiling scope (scopes can be nested)
+RLAPI void rlEndProfileScope(void);                                 // End current CPU profiling scope
+RLAPI void rlBeginProfileScopeGPU(const char *name);                // Begin named GPU profiling scope, GPU timer queries (scopes can be nested)
+RLAPI void rlEndProfileScopeGPU(void);                              // End current GPU profiling scope
+RLAPI void rlDrawProfiler(int posX, int posY, int width);           // Draw profiler flame-style timeline for last recorded frame
+RLAPI bool rlExportProfilerTrace(const char *fileName);             // Export recorded frames as Chrome trace JSON (chrome://tracing, Perfetto), returns true on success
+
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
 //------------------------------------------------------------------------------------
@@ -1304,6 +1386,18 @@ RLAPI bool rlCheckCollisionPointLine(rlVector2 point, rlVector2 p1, rlVector2 p2
 RLAPI bool rlCheckCollisionCircleLine(rlVector2 center, float radius, rlVector2 p1, rlVector2 p2);               // Check if circle collides with a line created betweeen two points [p1] and [p2]
 RLAPI rlRectangle rlGetCollisionRec(rlRectangle rec1, rlRectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
+// Basic shapes collision broadphase functions (spatial hash)
+RLAPI rlSpatialHash *rlLoadSpatialHash(float cellSize, int capacity);                                      // Load spatial hash broadphase, cell size close to common shapes size
+RLAPI void rlUnloadSpatialHash(rlSpatialHash *hash);                                                       // Unload spatial hash broadphase
+RLAPI int rlAddSpatialHashRec(rlSpatialHash *hash, rlRectangle rec);                                         // Add rectangle to spatial hash, returns proxy id
+RLAPI int rlAddSpatialHashCircle(rlSpatialHash *hash, rlVector2 center, float radius);                       // Add circle to spatial hash, returns proxy id
+RLAPI void rlUpdateSpatialHashRec(rlSpatialHash *hash, int id, rlRectangle rec);                             // Update spatial hash proxy as rectangle
+RLAPI void rlUpdateSpatialHashCircle(rlSpatialHash *hash, int id, rlVector2 center, float radius);           // Update spatial hash proxy as circle
+RLAPI void rlRemoveSpatialHashProxy(rlSpatialHash *hash, int id);                                          // Remove proxy from spatial hash (id can be reused)
+RLAPI int rlGetSpatialHashPairs(rlSpatialHash *hash, int *pairs, int maxPairs);                             // Get colliding proxies pairs (2 ids per pair), returns pairs count (can be greater than maxPairs)
+RLAPI int rlGetSpatialHashCollisionsRec(rlSpatialHash *hash, rlRectangle rec, int *ids, int maxIds);         // Get proxies colliding with rectangle, returns proxies count (can be greater than maxIds)
+RLAPI int rlGetSpatialHashCollisionsCircle(rlSpatialHash *hash, rlVector2 center, float radius, int *ids, int maxIds); // Get proxies colliding with circle, returns proxies count (can be greater than maxIds)
+
 //------------------------------------------------------------------------------------
 // rlTexture Loading and Drawing Functions (Module: textures)
 //------------------------------------------------------------------------------------
@@ -1545,6 +1639,14 @@ RLAPI rlModel rlLoadModelFromMesh(rlMesh mesh);
 RLAPI bool rlIsModelReady(rlModel model);                                                       // Check if a model is ready
 RLAPI void rlUnloadModel(rlModel model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI rlBoundingBox rlGetModelBoundingBox(rlModel model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI bool rlExportModel(rlModel model, const char *fileName);                                    // Export model data to file (.rmdl), returns true on success
+
+// rlModel async loading functions
+RLAPI rlModelAsync *rlLoadModelAsync(const char *fileName, ModelLoadedCallback callback, void *userData); // Load model on worker thread, GPU data uploaded by rlUpdateModelAsyncUploads() (callback is optional)
+RLAPI bool rlIsModelAsyncReady(rlModelAsync *handle);                                         // Check if async model is loaded and uploaded to GPU
+RLAPI rlModel rlGetModelAsync(rlModelAsync *handle);                                          // Get async loaded model (handle is released)
+RLAPI void rlUnloadModelAsync(rlModelAsync *handle);                                          // Unload async model, pending loading is cancelled (handle is released)
+RLAPI void rlUpdateModelAsyncUploads(int maxUploads);                                         // Upload loaded models meshes and textures to GPU, up to maxUploads per call (call on GL thread every frame)
 
 // rlModel drawing functions
 RLAPI void rlDrawModel(rlModel model, rlVector3 position, float scale, rlColor tint);               // Draw a model (with texture if set)
@@ -1564,8 +1666,17 @@ RLAPI void rlUpdateMeshBuffer(rlMesh mesh, int index, const void *data, int data
 RLAPI void rlUnloadMesh(rlMesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void rlDrawMesh(rlMesh mesh, rlMaterial material, rlMatrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void rlDrawMeshInstanced(rlMesh mesh, rlMaterial material, const rlMatrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void rlDrawMeshInstancedBuffer(rlMesh mesh, rlMaterial material, rlInstanceBuffer buffer, int instances); // Draw mesh instances stored in instance buffer (first instances)
 RLAPI rlBoundingBox rlGetMeshBoundingBox(rlMesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void rlGenMeshTangents(rlMesh *mesh);                                                     // Compute mesh tangents
+
+// Instance buffer management functions
+RLAPI rlInstanceBuffer rlLoadInstanceBuffer(int capacity, bool colors);                          // Load instance buffer in GPU for instanced mesh drawing (transforms and optional colors)
+RLAPI int rlAddInstanceBufferAttribute(rlInstanceBuffer *buffer, int locIndex, int components); // Add custom per-instance float attribute bound to shader attribute location, returns index
+RLAPI void rlUpdateInstanceTransforms(rlInstanceBuffer buffer, const rlMatrix *transforms, int offset, int count); // Update instances transforms, starting at instance offset
+RLAPI void rlUpdateInstanceColors(rlInstanceBuffer buffer, const rlColor *colors, int offset, int count); // Update instances colors, starting at instance offset
+RLAPI void rlUpdateInstanceAttribute(rlInstanceBuffer buffer, int index, const float *data, int offset, int count); // Update instances custom attribute data, starting at instance offset
+RLAPI void rlUnloadInstanceBuffer(rlInstanceBuffer buffer);                                       // Unload instance buffer from GPU memory (VRAM)
 RLAPI bool rlExportMesh(rlMesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool rlExportMeshAsCode(rlMesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1592,11 +1703,17 @@ RLAPI void rlSetModelMeshMaterial(rlModel *model, int meshId, int materialId);
 
 // rlModel animations loading/unloading functions
 RLAPI rlModelAnimation *rlLoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
+RLAPI bool rlExportModelAnimations(rlModelAnimation *animations, int animCount, const char *fileName); // Export model animations to file (.rmdl), returns true on success
 RLAPI void rlUpdateModelAnimation(rlModel model, rlModelAnimation anim, int frame);               // Update model animation pose
 RLAPI void rlUnloadModelAnimation(rlModelAnimation anim);                                       // Unload animation data
 RLAPI void rlUnloadModelAnimations(rlModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool rlIsModelAnimationValid(rlModel model, rlModelAnimation anim);                         // Check model animation skeleton match
+RLAPI void rlCompressModelAnimation(rlModelAnimation *anim, float tolerance);                   // Compress animation keyframes (framePoses freed and set to NULL), tolerance: max pose error
 RLAPI void rlUpdateModelAnimationBoneMatrices(rlModel model, rlModelAnimation anim, int frame);   // Update model animation mesh bone matrices (Note GPU skinning does not work on Mac)
+RLAPI void rlGetModelAnimationPose(rlModelAnimation anim, float frame, rlTransform *pose);       // Get animation pose at fractional frame (anim.boneCount transforms)
+RLAPI void rlBlendModelAnimationLayers(rlModel model, const rlAnimationLayer *layers, int layerCount, rlTransform *pose); // Blend animation layers over bind pose (model.boneCount transforms)
+RLAPI void rlUpdateModelAnimationLayers(rlModel model, const rlAnimationLayer *layers, int layerCount); // Update model animation pose from blended layers
+RLAPI void rlUpdateModelAnimationLayersBoneMatrices(rlModel model, const rlAnimationLayer *layers, int layerCount); // Update model mesh bone matrices from blended layers
 
 // Collision detection functions
 RLAPI bool rlCheckCollisionSpheres(rlVector3 center1, float radius1, rlVector3 center2, float radius2);   // Check collision between two spheres
@@ -1605,9 +1722,33 @@ RLAPI bool rlCheckCollisionBoxSphere(rlBoundingBox box, rlVector3 center, float
 RLAPI rlRayCollision rlGetRayCollisionSphere(rlRay ray, rlVector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI rlRayCollision rlGetRayCollisionBox(rlRay ray, rlBoundingBox box);                                    // Get collision info between ray and box
 RLAPI rlRayCollision rlGetRayCollisionMesh(rlRay ray, rlMesh mesh, rlMatrix transform);                       // Get collision info between ray and mesh
+RLAPI rlMeshBVH rlLoadMeshBVH(rlMesh mesh);                                                             // Load mesh bounding volume hierarchy for ray queries (built from mesh vertex data)
+RLAPI void rlUnloadMeshBVH(rlMeshBVH bvh);                                                              // Unload mesh bounding volume hierarchy
+RLAPI rlRayCollision rlGetRayCollisionMeshBVH(rlRay ray, rlMeshBVH bvh, rlMatrix transform);                  // Get collision info between ray and mesh using its bounding volume hierarchy
 RLAPI rlRayCollision rlGetRayCollisionTriangle(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3);            // Get collision info between ray and triangle
 RLAPI rlRayCollision rlGetRayCollisionQuad(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3, rlVector3 p4);    // Get collision info between ray and quad
 
+// Collision detection functions: batches
+// NOTE: Rays are tested in packets (SIMD-friendly), packets are dispatched with parallel-for jobs
+RLAPI void rlGetRayCollisionSphereBatch(const rlRay *rays, int count, rlVector3 center, float radius, rlRayCollision *collisions); // Get collision info between rays and sphere
+RLAPI void rlGetRayCollisionBoxBatch(const rlRay *rays, int count, rlBoundingBox box, rlRayCollision *collisions);               // Get collision info between rays and box
+RLAPI void rlGetRayCollisionMeshBatch(const rlRay *rays, int count, rlMesh mesh, rlMatrix transform, rlRayCollision *collisions);  // Get collision info between rays and mesh
+RLAPI void rlGetRayCollisionMeshBVHBatch(const rlRay *rays, int count, rlMeshBVH bvh, rlMatrix transform, rlRayCollision *collisions); // Get collision info between rays and mesh using its bounding volume hierarchy
+RLAPI void rlGetRayCollisionTriangleBatch(const rlRay *rays, int count, rlVector3 p1, rlVector3 p2, rlVector3 p3, rlRayCollision *collisions); // Get collision info between rays and triangle
+
+// Collision detection functions: broadphase (dynamic bounding box tree)
+RLAPI rlAABBTree *rlLoadAABBTree(float margin, int capacity);                                            // Load dynamic bounding box tree, proxies bounds are enlarged by margin
+RLAPI void rlUnloadAABBTree(rlAABBTree *tree);                                                           // Unload dynamic bounding box tree
+RLAPI int rlAddAABBTreeProxy(rlAABBTree *tree, rlBoundingBox box);                                         // Add bounding box to tree, returns proxy id
+RLAPI bool rlUpdateAABBTreeProxy(rlAABBTree *tree, int id, rlBoundingBox box);                             // Update proxy bounding box, returns true if proxy was moved in tree
+RLAPI void rlRemoveAABBTreeProxy(rlAABBTree *tree, int id);                                                // Remove proxy from tree (id can be reused)
+RLAPI int rlGetAABBTreePairs(rlAABBTree *tree, int *pairs, int maxPairs);                                  // Get colliding proxies pairs (2 ids per pair), returns pairs count (can be greater than maxPairs)
+RLAPI int rlGetAABBTreeCollisionsBox(rlAABBTree *tree, rlBoundingBox box, int *ids, int maxIds);             // Get proxies colliding with box, returns proxies count (can be greater than maxIds)
+RLAPI int rlGetAABBTreeCollisionsSphere(rlAABBTree *tree, rlVector3 center, float radius, int *ids, int maxIds); // Get proxies colliding with sphere, returns proxies count (can be greater than maxIds)
+RLAPI int rlGetAABBTreeCollisionsRay(rlAABBTree *tree, rlRay ray, int *ids, int maxIds);                     // Get proxies hit by ray, returns proxies count (can be greater than maxIds)
+RLAPI int rlGetAABBTreeCollisionsFrustum(rlAABBTree *tree, rlMatrix viewProjection, int *ids, int maxIds);   // Get proxies inside or intersecting camera frustum, returns proxies count (can be greater than maxIds)
+RLAPI rlRayCollision rlGetAABBTreeRayCollision(rlAABBTree *tree, rlRay ray, int *id);                        // Get collision info between ray and closest proxy (id is -1 if no hit)
+
 //------------------------------------------------------------------------------------
 // Audio Loading and Playing Functions (Module: audio)
 //------------------------------------------------------------------------------------
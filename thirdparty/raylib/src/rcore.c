@@ -55,6 +55,9 @@
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
 *
+*       #define SUPPORT_JOB_SYSTEM
+*           Initialize job system worker threads on rlInitWindow(), used by library parallel functions and user jobs
+*
 *   DEPENDENCIES:
 *       raymath  - 3D math functionality (rlVector2, rlVector3, rlMatrix, Quaternion)
 *       camera   - Multiple 3D camera modes (free, orbital, 1st person, 3rd person)
@@ -109,6 +112,7 @@
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in rlBeginMode3D()], atan2f() [Used in rlLoadVrStereoConfig()]
+#include <ctype.h>                  // Required for: tolower() [Used in rlIsFileExtension()]
 
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
@@ -249,6 +253,22 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
 
+#ifndef MAX_PROFILER_FRAMES
+    #define MAX_PROFILER_FRAMES          120        // Maximum number of frames kept by profiler (trace export)
+#endif
+#ifndef MAX_PROFILER_SCOPES
+    #define MAX_PROFILER_SCOPES          256        // Maximum number of profiling scopes per frame
+#endif
+#ifndef MAX_PROFILER_GPU_SCOPES
+    #define MAX_PROFILER_GPU_SCOPES       32        // Maximum number of GPU profiling scopes per frame
+#endif
+#ifndef MAX_PROFILER_SCOPE_DEPTH
+    #define MAX_PROFILER_SCOPE_DEPTH      32        // Maximum profiling scopes nesting depth
+#endif
+#define PROFILER_GPU_LATENCY               3        // GPU timer queries frames in flight, read (PROFILER_GPU_LATENCY - 1) frames after recording (avoid pipeline stalls)
+#define PROFILER_ROW_HEIGHT               14        // Profiler timeline row height (rlDrawProfiler())
+#define PROFILER_TRACE_NAME_LENGTH       128        // Maximum scope name characters exported to trace (rlExportProfilerTrace())
+
 #ifndef MAX_AUTOMATION_EVENTS
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
@@ -473,6 +493,40 @@ static rlAutomationEventList *currentEventList = NULL;        // Current automat
 static bool automationEventRecording = false;               // Recording automation events flag
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
 #endif
+
+#if defined(SUPPORT_PROFILER)
+// Profiler scope, named code section timing on a frame
+typedef struct ProfilerScope {
+    const char *name;               // Scope name (not copied, static string recommended)
+    int depth;                      // Scope nesting depth
+    int query;                      // GPU scope queries index on frame, -1 for CPU scopes
+    double start;                   // Scope start time in seconds (since InitTimer())
+    double duration;                // Scope duration in seconds, -1.0 for GPU scopes not available
+} ProfilerScope;
+
+// Profiler frame, scopes recorded from one rlEndDrawing() to the next one
+typedef struct ProfilerFrame {
+    unsigned int index;             // Frame index (profiler frames counter)
+    double start;                   // Frame start time in seconds (since InitTimer())
+    double duration;                // Frame duration in seconds
+    int scopeCount;                 // Scopes recorded count
+    ProfilerScope scopes[MAX_PROFILER_SCOPES];  // Scopes recorded
+} ProfilerFrame;
+
+// Profiler state
+static struct {
+    bool enabled;                   // Profiler enabled flag
+    ProfilerFrame *frames;          // Frames recorded (ring buffer, MAX_PROFILER_FRAMES)
+    unsigned int frameCounter;      // Frames counter, current frame recording
+    int cpuStack[MAX_PROFILER_SCOPE_DEPTH];     // CPU scopes open (scope index on current frame)
+    int cpuDepth;                   // CPU scopes open count
+    int gpuStack[MAX_PROFILER_SCOPE_DEPTH];     // GPU scopes open (scope index on current frame)
+    int gpuDepth;                   // GPU scopes open count
+    int gpuSupport;                 // GPU timer queries support: 0-unknown, 1-supported, -1-not supported
+    unsigned int *queries;          // GPU timer queries (PROFILER_GPU_LATENCY frames in flight, begin/end per scope)
+    int gpuQueryCount[PROFILER_GPU_LATENCY];    // GPU scopes queries used per frame
+} profiler = { 0 };
+#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -485,6 +539,11 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadInstanceBufferDefault(void);  // [Module: models] Unloads default instance buffer from GPU memory
+extern void UnloadModelAsyncUploads(void);      // [Module: models] Unloads async loaded models waiting for GPU upload
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -499,6 +558,16 @@ static void ScanDirectoryFilesRecursively(const char *basePath, rlFilePathList *
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_PROFILER)
+static int ProfilerAddScope(const char *name, int depth, double start, int query);  // Add scope to current profiler frame
+static int ProfilerAddScopeGPU(const char *name, int depth);    // Add GPU scope to current profiler frame, recording begin timestamp
+static unsigned int ProfilerQueryId(unsigned int frame, int query, int end);    // Get GPU query id for a frame scope
+static void ProfilerResolveGPU(unsigned int frameIndex);        // Resolve GPU scopes timings for a recorded frame
+static void ProfilerNewFrame(void);                             // End current profiler frame and start a new one
+static void ProfilerScopeCallback(const char *name, bool begin); // Profiling scope callback for rlgl render batch draws
+static void ProfilerEscapeName(const char *name, char *escaped); // Escape scope name for trace JSON string
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: rlWaitTime()
@@ -525,6 +594,8 @@ const char *rlTextFormat(const char *text, ...);              // Formatting of t
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_TEMPLATE)
+    #include "platforms/rcore_template.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -594,6 +665,12 @@ void rlInitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_TEMPLATE)
+    #if defined(GRAPHICS_API_NULL)
+    TRACELOG(LOG_INFO, "Platform backend: TEMPLATE (HEADLESS)");
+    #else
+    TRACELOG(LOG_INFO, "Platform backend: TEMPLATE");
+    #endif
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -648,6 +725,11 @@ void rlInitWindow(int width, int height, const char *title)
     InitPlatform();
     //--------------------------------------------------------------
 
+#if defined(SUPPORT_JOB_SYSTEM)
+    // Initialize job system, skipped if already initialized by user
+    if (!rlIsJobSystemReady()) rlInitJobSystem(0);
+#endif
+
     // Initialize rlgl default data (buffers and shaders)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -711,6 +793,20 @@ void rlCloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadInstanceBufferDefault();  // WARNING: Module required: rmodels
+#endif
+
+    rlCloseJobSystem();         // Stop job system worker threads
+
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadModelAsyncUploads();  // WARNING: Module required: rmodels (after job system, async loading jobs are done)
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    rlDisableProfiler();        // Unload profiler data and GPU queries
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -858,6 +954,11 @@ void rlBeginDrawing(void)
 
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
+
+#if defined(SUPPORT_PROFILER)
+    rlBeginProfileScope("Drawing");
+    rlBeginProfileScopeGPU("Drawing");
+#endif
 }
 
 // End canvas drawing and swap buffers (double buffering)
@@ -910,8 +1011,19 @@ void rlEndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    rlEndProfileScopeGPU();
+    rlEndProfileScope();
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+#if defined(SUPPORT_PROFILER)
+    rlBeginProfileScope("rlSwapScreenBuffer");
+#endif
     rlSwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+#if defined(SUPPORT_PROFILER)
+    rlEndProfileScope();
+#endif
 
     // Frame time control system
     CORE.Time.current = rlGetTime();
@@ -923,7 +1035,13 @@ void rlEndDrawing(void)
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
     {
+#if defined(SUPPORT_PROFILER)
+        rlBeginProfileScope("rlWaitTime");
+#endif
         rlWaitTime(CORE.Time.target - CORE.Time.frame);
+#if defined(SUPPORT_PROFILER)
+        rlEndProfileScope();
+#endif
 
         CORE.Time.current = rlGetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -932,7 +1050,13 @@ void rlEndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+#if defined(SUPPORT_PROFILER)
+    rlBeginProfileScope("rlPollInputEvents");
+#endif
     rlPollInputEvents();      // Poll user events (before next frame update)
+#if defined(SUPPORT_PROFILER)
+    rlEndProfileScope();
+#endif
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
@@ -973,6 +1097,10 @@ void rlEndDrawing(void)
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+#if defined(SUPPORT_PROFILER)
+    if (profiler.enabled) ProfilerNewFrame();
+#endif
+
     CORE.Time.frameCounter++;
 }
 
@@ -1323,6 +1451,7 @@ rlShader rlLoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
         shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
         shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+        shader.locs[SHADER_LOC_VERTEX_INSTANCE_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR);
 
         // Get handles to GLSL uniform locations (vertex shader)
         shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
@@ -1895,24 +2024,23 @@ bool rlIsFileExtension(const char *fileName, const char *ext)
 
     if (fileExt != NULL)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = rlTextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
-
+        // NOTE: Extensions are split and lowercased on local buffers (not rtext static buffers),
+        // so function can be used by loaders running on worker threads (async loading)
         char fileExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
-        strncpy(fileExtLower, rlTextToLower(fileExt), MAX_FILE_EXTENSION_LENGTH); // WARNING: Module required: rtext
+        for (int i = 0; (i < MAX_FILE_EXTENSION_LENGTH) && (fileExt[i] != '\0'); i++) fileExtLower[i] = (char)tolower((unsigned char)fileExt[i]);
+
+        const char *checkExt = ext;
 
-        for (int i = 0; i < extCount; i++)
+        while (!result && (checkExt != NULL))
         {
-            if (strcmp(fileExtLower, rlTextToLower(checkExts[i])) == 0)
-            {
-                result = true;
-                break;
-            }
+            char checkExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
+            for (int i = 0; (i < MAX_FILE_EXTENSION_LENGTH) && (checkExt[i] != '\0') && (checkExt[i] != ';'); i++) checkExtLower[i] = (char)tolower((unsigned char)checkExt[i]);
+
+            if (strcmp(fileExtLower, checkExtLower) == 0) result = true;
+
+            checkExt = strchr(checkExt, ';');
+            if (checkExt != NULL) checkExt++;
         }
-#else
-        if (strcmp(fileExt, ext) == 0) result = true;
-#endif
     }
 
     return result;
@@ -2828,6 +2956,272 @@ void rlPlayAutomationEvent(rlAutomationEvent event)
 #endif
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Profiling
+//----------------------------------------------------------------------------------
+
+// Enable profiler, scopes recorded per frame
+// NOTE: Frames and GPU queries memory is allocated on enable, no cost while disabled
+void rlEnableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (profiler.enabled) return;
+
+    profiler.frames = (ProfilerFrame *)RL_CALLOC(MAX_PROFILER_FRAMES, sizeof(ProfilerFrame));
+    if (profiler.frames == NULL)
+    {
+        TRACELOG(LOG_WARNING, "PROFILER: Failed to allocate frames memory, profiler not enabled");
+        return;
+    }
+
+    profiler.frameCounter = 0;
+    profiler.cpuDepth = 0;
+    profiler.gpuDepth = 0;
+    profiler.frames[0].start = rlGetTime();
+    profiler.enabled = true;
+
+    rlSetProfileScopeCallback(ProfilerScopeCallback);   // Render batch draws scopes (rlgl)
+
+    TRACELOG(LOG_INFO, "PROFILER: Enabled, recording up to %i frames", MAX_PROFILER_FRAMES);
+#endif
+}
+
+// Disable profiler, recorded frames are discarded
+void rlDisableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled) return;
+
+    rlSetProfileScopeCallback(NULL);
+
+    if (profiler.queries != NULL)
+    {
+        for (int i = 0; i < PROFILER_GPU_LATENCY*MAX_PROFILER_GPU_SCOPES*2; i++) rlUnloadTimerQuery(profiler.queries[i]);
+        RL_FREE(profiler.queries);
+        profiler.queries = NULL;
+    }
+
+    RL_FREE(profiler.frames);
+    profiler.frames = NULL;
+    profiler.gpuSupport = 0;
+    profiler.enabled = false;
+
+    TRACELOG(LOG_INFO, "PROFILER: Disabled");
+#endif
+}
+
+// Check if profiler is enabled
+bool rlIsProfilerEnabled(void)
+{
+#if defined(SUPPORT_PROFILER)
+    return profiler.enabled;
+#else
+    return false;
+#endif
+}
+
+// Begin named CPU profiling scope
+// NOTE: Scope name is not copied, it must be kept valid (static string recommended)
+void rlBeginProfileScope(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.cpuDepth >= MAX_PROFILER_SCOPE_DEPTH)) return;
+
+    profiler.cpuStack[profiler.cpuDepth] = ProfilerAddScope(name, profiler.cpuDepth, rlGetTime(), -1);
+    profiler.cpuDepth++;
+#endif
+}
+
+// End current CPU profiling scope
+void rlEndProfileScope(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.cpuDepth == 0)) return;
+
+    profiler.cpuDepth--;
+    int index = profiler.cpuStack[profiler.cpuDepth];
+
+    if (index >= 0)
+    {
+        ProfilerScope *scope = &profiler.frames[profiler.frameCounter%MAX_PROFILER_FRAMES].scopes[index];
+        scope->duration = rlGetTime() - scope->start;
+    }
+#endif
+}
+
+// Begin named GPU profiling scope
+// NOTE: GPU time measured with timestamp queries, results available a few frames later
+void rlBeginProfileScopeGPU(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.gpuDepth >= MAX_PROFILER_SCOPE_DEPTH)) return;
+
+    profiler.gpuStack[profiler.gpuDepth] = ProfilerAddScopeGPU(name, profiler.gpuDepth);
+    profiler.gpuDepth++;
+#endif
+}
+
+// End current GPU profiling scope
+void rlEndProfileScopeGPU(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.gpuDepth == 0)) return;
+
+    profiler.gpuDepth--;
+    int index = profiler.gpuStack[profiler.gpuDepth];
+
+    if (index >= 0)
+    {
+        ProfilerFrame *frame = &profiler.frames[profiler.frameCounter%MAX_PROFILER_FRAMES];
+        rlQueryTimestamp(ProfilerQueryId(profiler.frameCounter, frame->scopes[index].query, 1));
+    }
+#endif
+}
+
+// Draw profiler flame-style timeline for last recorded frame
+// NOTE: CPU scopes shown for last frame, GPU scopes for last frame with results available
+void rlDrawProfiler(int posX, int posY, int width)
+{
+#if defined(SUPPORT_PROFILER) && defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
+    if (!profiler.enabled || (profiler.frameCounter == 0)) return;
+
+    static const rlColor scopeColors[] = { SKYBLUE, LIME, GOLD, ORANGE, PINK, VIOLET, BEIGE, PURPLE, GREEN, MAROON };
+
+    const ProfilerFrame *frame = &profiler.frames[(profiler.frameCounter - 1)%MAX_PROFILER_FRAMES];
+    // NOTE: Frame (frameCounter - 1) resolved frame (frameCounter - PROFILER_GPU_LATENCY) GPU timings on rlEndDrawing()
+    const ProfilerFrame *frameGPU = NULL;
+    if (profiler.frameCounter >= PROFILER_GPU_LATENCY) frameGPU = &profiler.frames[(profiler.frameCounter - PROFILER_GPU_LATENCY)%MAX_PROFILER_FRAMES];
+
+    // Timeline scaled to target frame time, unless frame takes longer
+    double timeScale = (frame->duration > CORE.Time.target)? frame->duration : CORE.Time.target;
+    if (timeScale <= 0.0) return;
+
+    int cpuRows = 0;
+    int gpuRows = 0;
+    double gpuTime = 0.0;
+
+    for (int i = 0; i < frame->scopeCount; i++)
+    {
+        if ((frame->scopes[i].query < 0) && (frame->scopes[i].depth + 1 > cpuRows)) cpuRows = frame->scopes[i].depth + 1;
+    }
+
+    if (frameGPU != NULL)
+    {
+        for (int i = 0; i < frameGPU->scopeCount; i++)
+        {
+            const ProfilerScope *scope = &frameGPU->scopes[i];
+            if ((scope->query < 0) || (scope->duration < 0.0)) continue;
+
+            if (scope->depth + 1 > gpuRows) gpuRows = scope->depth + 1;
+            if (scope->depth == 0) gpuTime += scope->duration;
+        }
+    }
+
+    int height = PROFILER_ROW_HEIGHT*(cpuRows + gpuRows + 1) + 4;
+    rlDrawRectangle(posX, posY, width, height, (rlColor){ 0, 0, 0, 180 });
+    rlDrawText(rlTextFormat("CPU: %.2f ms   GPU: %.2f ms", frame->duration*1000.0, gpuTime*1000.0), posX + 4, posY + 2, 10, RAYWHITE);
+
+    // Draw CPU scopes and GPU scopes rows
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const ProfilerFrame *current = (pass == 0)? frame : frameGPU;
+        if (current == NULL) continue;
+
+        int rowsY = posY + PROFILER_ROW_HEIGHT*((pass == 0)? 1 : (cpuRows + 1)) + 2;
+
+        for (int i = 0; i < current->scopeCount; i++)
+        {
+            const ProfilerScope *scope = &current->scopes[i];
+            if ((pass == 0) && (scope->query >= 0)) continue;
+            if ((pass == 1) && ((scope->query < 0) || (scope->duration < 0.0))) continue;
+
+            int x = (int)((scope->start - current->start)/timeScale*width);
+            int w = (int)(scope->duration/timeScale*width);
+            if (x >= width) continue;
+            if (x + w > width) w = width - x;
+            if (w < 1) w = 1;
+
+            unsigned int hash = 5381;
+            for (int c = 0; scope->name[c] != '\0'; c++) hash = hash*33 + (unsigned char)scope->name[c];
+
+            int y = rowsY + scope->depth*PROFILER_ROW_HEIGHT;
+            rlDrawRectangle(posX + x, y, w, PROFILER_ROW_HEIGHT - 1, scopeColors[hash%(sizeof(scopeColors)/sizeof(rlColor))]);
+
+            const char *label = (pass == 0)? scope->name : rlTextFormat("GPU %s", scope->name);
+            if (rlMeasureText(label, 10) + 4 < w) rlDrawText(label, posX + x + 2, y + 2, 10, BLACK);
+        }
+    }
+#endif
+}
+
+// Export recorded frames as Chrome trace JSON (chrome://tracing, Perfetto)
+// NOTE: CPU scopes exported on thread 1, GPU scopes on thread 2 (aligned to frame start)
+bool rlExportProfilerTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.frameCounter == 0)) return success;
+
+    // Export completed frames only, current frame is still recording
+    unsigned int frameCount = (profiler.frameCounter < MAX_PROFILER_FRAMES)? profiler.frameCounter : MAX_PROFILER_FRAMES - 1;
+    unsigned int firstFrame = profiler.frameCounter - frameCount;
+
+    int eventCount = 0;
+    for (unsigned int f = firstFrame; f < profiler.frameCounter; f++) eventCount += profiler.frames[f%MAX_PROFILER_FRAMES].scopeCount + 1;
+
+    // NOTE: Events longer than expected are truncated to the remaining space, output is kept NULL terminated
+    int txtSize = (128 + 2*PROFILER_TRACE_NAME_LENGTH)*eventCount + 1024;     // Characters per event (escaped name) plus some header
+    char *txtData = (char *)RL_CALLOC(txtSize, sizeof(char));
+    if (txtData == NULL)
+    {
+        TRACELOG(LOG_WARNING, "PROFILER: Failed to allocate trace export memory");
+        return success;
+    }
+
+    char name[2*PROFILER_TRACE_NAME_LENGTH + 1] = { 0 };
+    int length = 0;
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    byteCount += sprintf(txtData + byteCount, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n");
+    byteCount += sprintf(txtData + byteCount, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}");
+
+    for (unsigned int f = firstFrame; f < profiler.frameCounter; f++)
+    {
+        const ProfilerFrame *frame = &profiler.frames[f%MAX_PROFILER_FRAMES];
+
+        length = snprintf(txtData + byteCount, txtSize - byteCount, ",\n{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+            frame->index, frame->start*1e6, frame->duration*1e6);
+        if (length > 0) byteCount += (length < (txtSize - byteCount))? length : (txtSize - byteCount - 1);
+
+        for (int i = 0; i < frame->scopeCount; i++)
+        {
+            const ProfilerScope *scope = &frame->scopes[i];
+            if (scope->duration < 0.0) continue;    // GPU results not available
+
+            ProfilerEscapeName(scope->name, name);
+
+            length = snprintf(txtData + byteCount, txtSize - byteCount, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%i}",
+                name, (scope->query < 0)? "cpu" : "gpu", scope->start*1e6, scope->duration*1e6, (scope->query < 0)? 1 : 2);
+            if (length > 0) byteCount += (length < (txtSize - byteCount))? length : (txtSize - byteCount - 1);
+        }
+    }
+
+    // NOTE: Trace closing is always written, space reserved by header
+    if (byteCount > (txtSize - 8)) byteCount = txtSize - 8;
+    byteCount += sprintf(txtData + byteCount, "\n]}\n");
+
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = rlSaveFileText(fileName, txtData);
+
+    RL_FREE(txtData);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Trace exported successfully (%i frames)", fileName, frameCount);
+#endif
+
+    return success;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Input Handling: Keyboard
 //----------------------------------------------------------------------------------
@@ -3748,6 +4142,178 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_PROFILER)
+// Add scope to current profiler frame, returns scope index (-1 if frame is full)
+static int ProfilerAddScope(const char *name, int depth, double start, int query)
+{
+    ProfilerFrame *frame = &profiler.frames[profiler.frameCounter%MAX_PROFILER_FRAMES];
+    if (frame->scopeCount >= MAX_PROFILER_SCOPES) return -1;
+
+    ProfilerScope *scope = &frame->scopes[frame->scopeCount];
+    scope->name = name;
+    scope->depth = depth;
+    scope->start = start;
+    scope->duration = (query < 0)? 0.0 : -1.0;
+    scope->query = query;
+
+    frame->scopeCount++;
+
+    return frame->scopeCount - 1;
+}
+
+// Add GPU scope to current profiler frame, recording begin timestamp
+// NOTE: GPU queries are loaded on first GPU scope, once graphics device is ready
+static int ProfilerAddScopeGPU(const char *name, int depth)
+{
+    if ((profiler.gpuSupport == 0) && isGpuReady)
+    {
+        profiler.gpuSupport = -1;
+        profiler.queries = (unsigned int *)RL_CALLOC(PROFILER_GPU_LATENCY*MAX_PROFILER_GPU_SCOPES*2, sizeof(unsigned int));
+
+        if (profiler.queries == NULL) TRACELOG(LOG_WARNING, "PROFILER: Failed to allocate GPU queries memory, GPU scopes not recorded");
+        else
+        {
+            for (int i = 0; i < PROFILER_GPU_LATENCY*MAX_PROFILER_GPU_SCOPES*2; i++) profiler.queries[i] = rlLoadTimerQuery();
+
+            if (profiler.queries[0] > 0) profiler.gpuSupport = 1;
+            else TRACELOG(LOG_WARNING, "PROFILER: GPU timer queries not supported, GPU scopes not recorded");
+        }
+    }
+
+    if (profiler.gpuSupport <= 0) return -1;
+
+    int slot = profiler.frameCounter%PROFILER_GPU_LATENCY;
+    if (profiler.gpuQueryCount[slot] >= MAX_PROFILER_GPU_SCOPES) return -1;
+
+    int index = ProfilerAddScope(name, depth, 0.0, profiler.gpuQueryCount[slot]);
+
+    if (index >= 0)
+    {
+        rlQueryTimestamp(ProfilerQueryId(profiler.frameCounter, profiler.gpuQueryCount[slot], 0));
+        profiler.gpuQueryCount[slot]++;
+    }
+
+    return index;
+}
+
+// Get GPU query id for a frame scope, begin (0) or end (1) timestamp
+static unsigned int ProfilerQueryId(unsigned int frame, int query, int end)
+{
+    return profiler.queries[((frame%PROFILER_GPU_LATENCY)*MAX_PROFILER_GPU_SCOPES + query)*2 + end];
+}
+
+// Resolve GPU scopes timings for a recorded frame
+// NOTE: Results not available are discarded (GPU scope duration kept as -1.0), queries are reused next frame
+static void ProfilerResolveGPU(unsigned int frameIndex)
+{
+    ProfilerFrame *frame = &profiler.frames[frameIndex%MAX_PROFILER_FRAMES];
+
+    unsigned long long int begin[MAX_PROFILER_GPU_SCOPES] = { 0 };
+    unsigned long long int end[MAX_PROFILER_GPU_SCOPES] = { 0 };
+    bool available[MAX_PROFILER_GPU_SCOPES] = { 0 };
+    unsigned long long int frameBegin = 0;
+
+    for (int i = 0; i < frame->scopeCount; i++)
+    {
+        int query = frame->scopes[i].query;
+        if (query < 0) continue;
+
+        available[query] = rlGetTimerQueryResult(ProfilerQueryId(frameIndex, query, 0), &begin[query]) &&
+                           rlGetTimerQueryResult(ProfilerQueryId(frameIndex, query, 1), &end[query]);
+
+        if (available[query] && ((frameBegin == 0) || (begin[query] < frameBegin))) frameBegin = begin[query];
+    }
+
+    // GPU timeline aligned to frame start
+    for (int i = 0; i < frame->scopeCount; i++)
+    {
+        ProfilerScope *scope = &frame->scopes[i];
+        if ((scope->query < 0) || !available[scope->query]) continue;
+
+        scope->start = frame->start + (double)(begin[scope->query] - frameBegin)*1e-9;
+        scope->duration = (end[scope->query] > begin[scope->query])? (double)(end[scope->query] - begin[scope->query])*1e-9 : 0.0;
+    }
+}
+
+// End current profiler frame and start a new one
+// NOTE: Scopes still open are split, ended on current frame and continued on next frame
+static void ProfilerNewFrame(void)
+{
+    double time = rlGetTime();
+    ProfilerFrame *frame = &profiler.frames[profiler.frameCounter%MAX_PROFILER_FRAMES];
+
+    for (int i = 0; i < profiler.cpuDepth; i++)
+    {
+        if (profiler.cpuStack[i] >= 0) frame->scopes[profiler.cpuStack[i]].duration = time - frame->scopes[profiler.cpuStack[i]].start;
+    }
+
+    for (int i = 0; i < profiler.gpuDepth; i++)
+    {
+        if (profiler.gpuStack[i] >= 0) rlQueryTimestamp(ProfilerQueryId(profiler.frameCounter, frame->scopes[profiler.gpuStack[i]].query, 1));
+    }
+
+    frame->index = profiler.frameCounter;
+    frame->duration = time - frame->start;
+
+    // Resolve GPU timings before queries are reused
+    if ((profiler.gpuSupport > 0) && (profiler.frameCounter >= (PROFILER_GPU_LATENCY - 1))) ProfilerResolveGPU(profiler.frameCounter - (PROFILER_GPU_LATENCY - 1));
+
+    profiler.frameCounter++;
+
+    frame = &profiler.frames[profiler.frameCounter%MAX_PROFILER_FRAMES];
+    frame->index = profiler.frameCounter;
+    frame->start = time;
+    frame->duration = 0.0;
+    frame->scopeCount = 0;
+    profiler.gpuQueryCount[profiler.frameCounter%PROFILER_GPU_LATENCY] = 0;
+
+    for (int i = 0; i < profiler.cpuDepth; i++)
+    {
+        if (profiler.cpuStack[i] >= 0) profiler.cpuStack[i] = ProfilerAddScope(profiler.frames[(profiler.frameCounter - 1)%MAX_PROFILER_FRAMES].scopes[profiler.cpuStack[i]].name, i, time, -1);
+    }
+
+    for (int i = 0; i < profiler.gpuDepth; i++)
+    {
+        if (profiler.gpuStack[i] >= 0) profiler.gpuStack[i] = ProfilerAddScopeGPU(profiler.frames[(profiler.frameCounter - 1)%MAX_PROFILER_FRAMES].scopes[profiler.gpuStack[i]].name, i);
+    }
+}
+
+// Escape scope name for trace JSON string, escaped buffer size must be (2*PROFILER_TRACE_NAME_LENGTH + 1)
+// NOTE: Name is truncated to PROFILER_TRACE_NAME_LENGTH characters, control characters are replaced by spaces
+static void ProfilerEscapeName(const char *name, char *escaped)
+{
+    int length = 0;
+
+    for (int i = 0; (name[i] != '\0') && (i < PROFILER_TRACE_NAME_LENGTH); i++)
+    {
+        if ((name[i] == '"') || (name[i] == '\\'))
+        {
+            escaped[length++] = '\\';
+            escaped[length++] = name[i];
+        }
+        else if ((unsigned char)name[i] < 0x20) escaped[length++] = ' ';
+        else escaped[length++] = name[i];
+    }
+
+    escaped[length] = '\0';
+}
+
+// Profiling scope callback for rlgl render batch draws
+static void ProfilerScopeCallback(const char *name, bool begin)
+{
+    if (begin)
+    {
+        rlBeginProfileScope(name);
+        rlBeginProfileScopeGPU(name);
+    }
+    else
+    {
+        rlEndProfileScopeGPU();
+        rlEndProfileScope();
+    }
+}
+#endif  // SUPPORT_PROFILER
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
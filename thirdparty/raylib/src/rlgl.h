@@ -31,6 +31,11 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_NULL
+*           Use null graphics backend, no GPU or graphics context required (headless benchmarking/testing)
+*           OpenGL 3.3 Core is emulated, OpenGL calls are recorded (draw calls, uploaded bytes,
+*           state changes, texture binds) and can be queried with rlGetRecordStats()/rlGetRecordCommands()
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file.
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -53,12 +58,17 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (rlSetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_FLAGS                0    // Default render batch flags (rlRenderBatchFlags), i.e. RL_BATCH_PERSISTENT_MAPPED
+*       #define RL_DEFAULT_BATCH_RING_BUFFERS         3    // Default number of batch buffers when using RL_BATCH_PERSISTENT_MAPPED (ring)
+*       #define RL_SPRITE_BATCH_INSTANCES          4096    // Maximum number of instances per sprite batch draw call (rlDrawSpriteInstance())
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal rlMatrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
+*       #define RL_NULL_MAX_RECORD_COMMANDS        8192    // Maximum number of commands recorded by null backend (GRAPHICS_API_NULL)
+*
 *       When loading a shader, the following vertex attributes and uniform
 *       location names are tried to be set automatically:
 *
@@ -68,8 +78,10 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR "instanceColor"   // instance color (per-instance attribute, instanced drawing)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -185,6 +197,19 @@
     #define GRAPHICS_API_OPENGL_33
 #endif
 
+// Null graphics backend emulates OpenGL 3.3 Core functionality
+#if defined(GRAPHICS_API_NULL)
+    #if defined(GRAPHICS_API_OPENGL_11)
+        #undef GRAPHICS_API_OPENGL_11
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        #undef GRAPHICS_API_OPENGL_ES2
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_33)
+        #define GRAPHICS_API_OPENGL_33
+    #endif
+#endif
+
 // OpenGL ES 3.0 uses OpenGL ES 2.0 functionality (and more)
 #if defined(GRAPHICS_API_OPENGL_ES3)
     #define GRAPHICS_API_OPENGL_ES2
@@ -221,6 +246,25 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (rlSetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_FLAGS
+    #define RL_DEFAULT_BATCH_FLAGS                   0      // Default render batch flags (rlRenderBatchFlags)
+#endif
+#ifndef RL_DEFAULT_BATCH_RING_BUFFERS
+    #define RL_DEFAULT_BATCH_RING_BUFFERS            3      // Default number of batch buffers when using RL_BATCH_PERSISTENT_MAPPED (ring)
+#endif
+#define RL_BATCH_TEXTURE_SLOTS                       8      // Texture slots of multi-texture batches (RL_BATCH_MULTI_TEXTURE), fixed by batch shader
+
+// Texture unit bound to multi-texture batch texture slot, units 1..RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS are kept for additional sampler textures
+#define RL_BATCH_TEXTURE_SLOT_UNIT(slot)    (((slot) == 0)? 0 : RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + (slot))
+#ifndef RL_SPRITE_BATCH_INSTANCES
+    #define RL_SPRITE_BATCH_INSTANCES             4096      // Maximum number of instances per sprite batch draw call (rlDrawSpriteInstance())
+#endif
+
+// Null graphics backend commands recording
+#ifndef RL_NULL_MAX_RECORD_COMMANDS
+    #define RL_NULL_MAX_RECORD_COMMANDS           8192      // Maximum number of commands recorded by null backend (GRAPHICS_API_NULL)
+#endif
+#define RL_NULL_CUSTOM_ATTRIB_LOCATION               9      // First null backend location for non-default vertex attributes (after default attributes locations)
 
 // Internal rlMatrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -347,6 +391,9 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES     6
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT     6     // Render batch vertex texture slot (RL_BATCH_MULTI_TEXTURE), indices are not a shader attribute
+#endif
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
@@ -379,6 +426,7 @@ typedef struct rlMatrix {
 #endif
 
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// NOTE: Batches loaded with RL_BATCH_INTERLEAVED only use the interleaved array
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
@@ -386,6 +434,8 @@ typedef struct rlVertexBuffer {
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    unsigned char *interleaved; // Vertex data interleaved: position, texcoord, normal (optional), color, texture slot (optional) (shader-location = 0, 1, 2, 3, 6)
+    int vertexStride;           // Interleaved vertex size in bytes
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -394,18 +444,25 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    void *fence;                // OpenGL sync object guarding buffer reuse (RL_BATCH_PERSISTENT_MAPPED)
 } rlVertexBuffer;
 
 // Draw call type
 // NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
+// used at this moment (vaoId, matrices), raylib just forces a batch draw call if any
 // of those state-change happens (this is done in core module)
+// NOTE: In deferred draw mode, shader, blend mode, layer and depth changes also register a new draw,
+// draws are sorted and merged by state on batch drawing
 typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // rlShader id to be used on the draw -> Using RLGL.currentShaderId
+    unsigned int shaderId;      // rlShader id to be used on the draw (set on first vertex)
+    int *shaderLocs;            // rlShader locations to be used on the draw (set on first vertex)
+    int blendMode;              // Blend mode to be used on the draw (set on first vertex)
+    int layer;                  // Draw layer, lower layers are drawn first in deferred draw mode (set on first vertex)
+    float depth;                // Draw depth, greater depth drawn first in deferred draw mode (set on first vertex)
     unsigned int textureId;     // rlTexture id to be used on the draw -> Use to create new draw call if changes
 
     //rlMatrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
@@ -421,8 +478,97 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+    unsigned int flags;         // Batch flags in use (rlRenderBatchFlags)
+
+    unsigned int textureSlots[RL_BATCH_TEXTURE_SLOTS]; // Textures bound to texture units on batch drawing (RL_BATCH_MULTI_TEXTURE)
+    int textureSlotCount;       // Texture slots in use
+    int currentTextureSlot;     // Current texture slot for next vertex
 } rlRenderBatch;
 
+// Sprite instance, expanded to a textured quad by sprite batch vertex shader
+// NOTE: Same parameters as DrawTexturePro(), texture coordinates already normalized (flipping by swapping them)
+typedef struct rlSpriteInstance {
+    float dest[4];              // Destination rectangle (x, y, width, height)
+    float source[4];            // Texture coordinates of top-left and bottom-right corners (u0, v0, u1, v1)
+    float transform[4];         // Origin (x, y), rotation in degrees and depth (depth set by rlgl)
+    unsigned char color[4];     // Tint color (RGBA)
+} rlSpriteInstance;
+
+// rlCommandList type
+// NOTE: Draw commands recorded on CPU (no OpenGL calls), every thread can record its own command list,
+// command lists are submitted to current render batch on main thread with rlSubmitCommandLists()
+typedef struct rlCommandList {
+    int vertexCount;            // Number of vertex recorded
+    int vertexCapacity;         // Number of vertex allocated (arrays grow on demand)
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex), transformed on recording
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    float *normals;             // Vertex normal (XYZ - 3 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+
+    rlDrawCall *draws;          // Draw calls recorded (mode, vertexCount and textureId used)
+    int drawCounter;            // Draw calls counter
+    int drawCapacity;           // Draw calls allocated
+
+    unsigned int currentTexture; // Current texture id for next draw (0 for default texture)
+    float currentDepth;         // Current depth value for next 2D vertex
+    float texcoordx, texcoordy; // Current vertex texture coordinates
+    float normalx, normaly, normalz; // Current vertex normal
+    unsigned char colorr, colorg, colorb, colora; // Current vertex color
+
+    rlMatrix transform;         // Current transform matrix, applied to recorded vertex
+    rlMatrix *stack;            // rlMatrix stack for push/pop (RL_MAX_MATRIX_STACK_SIZE)
+    int stackCounter;           // rlMatrix stack counter
+} rlCommandList;
+
+// Render batch flags
+// NOTE: Vertex upload modes, RL_BATCH_PERSISTENT_MAPPED falls back to RL_BATCH_ORPHAN_UPLOAD if not supported
+typedef enum {
+    RL_BATCH_ORPHAN_UPLOAD = 1,         // Orphan buffers storage (glBufferData(NULL)) before uploading vertex data
+    RL_BATCH_PERSISTENT_MAPPED = 2,     // Write vertex data directly into persistently mapped buffers, ring guarded by fences (GL_ARB_buffer_storage)
+    RL_BATCH_INTERLEAVED = 4,           // Interleave vertex data in a single buffer (one upload per batch draw)
+    RL_BATCH_TEXCOORDS_HALF = 8,        // Store texcoords as half floats, requires RL_BATCH_INTERLEAVED (not for big atlases, 11 bits precision)
+    RL_BATCH_NO_NORMALS = 16,           // Do not store normals (2D-only batches), requires RL_BATCH_INTERLEAVED
+    RL_BATCH_MULTI_TEXTURE = 32,        // Textures assigned to batch texture slots referenced by vertex, no draw per texture change (default shader only), requires RL_BATCH_INTERLEAVED
+} rlRenderBatchFlags;
+
+// Recorded command type (null graphics backend)
+typedef enum {
+    RL_RECORD_DRAW = 0,         // Draw call (glDrawArrays, glDrawElements, instanced variants)
+    RL_RECORD_UPLOAD,           // Data uploaded to buffer or texture
+    RL_RECORD_TEXTURE_BIND,     // Texture bind
+    RL_RECORD_SHADER_BIND,      // Shader program bind
+    RL_RECORD_UNIFORM,          // Uniform upload
+    RL_RECORD_STATE,            // Pipeline state change (enable/disable, blending, depth, viewport, buffers binding...)
+    RL_RECORD_CLEAR             // Framebuffer clear
+} rlRecordCommandType;
+
+// Recorded command (null graphics backend)
+typedef struct rlRecordCommand {
+    int type;                   // Command type (rlRecordCommandType)
+    unsigned int id;            // Object id or OpenGL enum involved (texture, program, uniform location, capability...)
+    int count;                  // Vertex/elements count (draw) or elements count (uniform)
+    int instances;              // Instances count (draw)
+    int size;                   // Size in bytes (upload, uniform)
+} rlRecordCommand;
+
+// Recorded commands stats (null graphics backend)
+typedef struct rlRecordStats {
+    unsigned int drawCalls;                 // Draw calls issued
+    unsigned long long int vertices;        // Vertices (or elements) drawn, including instances
+    unsigned int uploads;                   // Buffer/texture data uploads
+    unsigned long long int uploadedBytes;   // Bytes uploaded
+    unsigned int textureBinds;              // Texture binds
+    unsigned int shaderBinds;               // Shader program binds
+    unsigned int uniformUploads;            // Uniform uploads
+    unsigned int stateChanges;              // Pipeline state changes
+    unsigned int clears;                    // Framebuffer clears
+    unsigned int commandCount;              // Commands recorded in command stream
+    unsigned int commandsDropped;           // Commands not recorded, command stream full
+} rlRecordStats;
+
+// Profiling scope callback, called on scope begin and end
+typedef void (*rlProfileScopeCallback)(const char *name, bool begin);
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -717,10 +863,32 @@ RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture i
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
 
+// GL state cache management
+// NOTE: rlgl skips redundant OpenGL calls (shader program, texture bindings, blending, batch uniforms),
+// cache must be invalidated if OpenGL state is modified outside rlgl
+RLAPI void rlInvalidateStateCache(void);                // Invalidate GL state cache, next calls are issued
+RLAPI void rlGetStateCacheCounters(unsigned int *issued, unsigned int *skipped); // Get GL state cache calls issued and skipped
+RLAPI void rlResetStateCacheCounters(void);             // Reset GL state cache calls counters
+
+// Null graphics backend recording (GRAPHICS_API_NULL)
+// NOTE: Stats and commands are empty for other graphics backends
+RLAPI rlRecordStats rlGetRecordStats(void);             // Get recorded commands stats
+RLAPI const rlRecordCommand *rlGetRecordCommands(int *count); // Get recorded commands stream
+RLAPI void rlResetRecord(void);                         // Reset recorded commands stream and stats
+
+// GPU timer queries and profiling
+// NOTE: Timestamp results are available a few frames later, read them without stalling the pipeline
+RLAPI unsigned int rlLoadTimerQuery(void);              // Load GPU timer query object, returns 0 if not supported
+RLAPI void rlUnloadTimerQuery(unsigned int id);         // Unload GPU timer query object
+RLAPI void rlQueryTimestamp(unsigned int id);           // Record GPU timestamp into query, once all previous commands are completed
+RLAPI bool rlGetTimerQueryResult(unsigned int id, unsigned long long int *timestamp); // Get GPU timestamp in nanoseconds, returns false if not available yet
+RLAPI void rlSetProfileScopeCallback(rlProfileScopeCallback callback); // Set profiling scope callback, called around render batch draws
+
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements); // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, unsigned int flags); // Load a render batch system with flags (rlRenderBatchFlags)
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
@@ -728,6 +896,34 @@ RLAPI void rlDrawRenderBatchActive(void);               // Update and draw inter
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlEnableDeferredDraw(void);                  // Enable deferred draw mode: batch draws sorted and merged by (layer, shader, blend mode, texture, depth)
+RLAPI void rlDisableDeferredDraw(void);                 // Disable deferred draw mode
+RLAPI void rlSetDrawLayer(int layer);                   // Set current draw layer, used by deferred draw mode (lower layers drawn first)
+RLAPI void rlSetDrawDepth(float depth);                 // Set current draw depth, used by deferred draw mode (greater depth drawn first, within layer)
+RLAPI bool rlDrawSpriteInstance(unsigned int textureId, const rlSpriteInstance *sprite); // Add sprite to instanced sprite batch, returns false if not available (use immediate mode)
+
+// Command lists management
+// NOTE: Command lists do not access rlgl state, they can be recorded on any thread (one command list per thread),
+// submission must be done on main thread, command lists are merged into current render batch in array order
+RLAPI rlCommandList rlLoadCommandList(int vertexCapacity); // Load a command list, arrays grow on demand
+RLAPI void rlUnloadCommandList(rlCommandList list);     // Unload command list
+RLAPI void rlResetCommandList(rlCommandList *list);     // Reset command list for new recording (memory is kept)
+RLAPI void rlCmdBegin(rlCommandList *list, int mode);   // Record vertex data start, mode can be RL_LINES, RL_TRIANGLES or RL_QUADS
+RLAPI void rlCmdEnd(rlCommandList *list);               // Record vertex data end
+RLAPI void rlCmdVertex2f(rlCommandList *list, float x, float y); // Record one vertex (position) - 2 float
+RLAPI void rlCmdVertex3f(rlCommandList *list, float x, float y, float z); // Record one vertex (position) - 3 float
+RLAPI void rlCmdTexCoord2f(rlCommandList *list, float x, float y); // Set current vertex texture coordinate - 2 float
+RLAPI void rlCmdNormal3f(rlCommandList *list, float x, float y, float z); // Set current vertex normal - 3 float
+RLAPI void rlCmdColor4ub(rlCommandList *list, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Set current vertex color - 4 byte
+RLAPI void rlCmdSetTexture(rlCommandList *list, unsigned int id); // Set current texture for next draws (0 for default texture)
+RLAPI void rlCmdPushMatrix(rlCommandList *list);        // Push the current transform matrix to command list stack
+RLAPI void rlCmdPopMatrix(rlCommandList *list);         // Pop latest inserted matrix from command list stack
+RLAPI void rlCmdLoadIdentity(rlCommandList *list);      // Reset current transform matrix to identity matrix
+RLAPI void rlCmdTranslatef(rlCommandList *list, float x, float y, float z); // Multiply the current transform matrix by a translation matrix
+RLAPI void rlCmdRotatef(rlCommandList *list, float angle, float x, float y, float z); // Multiply the current transform matrix by a rotation matrix
+RLAPI void rlCmdScalef(rlCommandList *list, float x, float y, float z); // Multiply the current transform matrix by a scaling matrix
+RLAPI void rlCmdMultMatrixf(rlCommandList *list, const float *matf); // Multiply the current transform matrix by another matrix
+RLAPI void rlSubmitCommandLists(const rlCommandList *lists, int count); // Submit command lists to current render batch, in array order (main thread only)
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -737,6 +933,7 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
+RLAPI void rlOrphanVertexBuffer(unsigned int bufferId, int size);                 // Orphan dynamic vertex buffer storage, previous data not available (avoids GPU sync on next update)
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);    // Unload vertex buffer object
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset); // Set vertex attribute data configuration
@@ -754,6 +951,8 @@ RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
+RLAPI unsigned short rlFloatToHalf(float x);                              // Convert float to half-float (stored as unsigned short)
+RLAPI float rlHalfToFloat(unsigned short x);                              // Convert half-float (stored as unsigned short) to float
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
@@ -993,12 +1192,18 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
+#endif
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
 #endif
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR "instanceColor"   // instance color (per-instance attribute, instanced drawing)
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1031,10 +1236,25 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+#define RL_STATE_CACHE_TEXTURE_UNITS    16          // Texture units tracked by GL state cache
+#define RL_STATE_CACHE_SHADERS           8          // Shader programs tracked by GL state cache batch uniforms
+#define RL_STATE_CACHE_UNKNOWN  0xFFFFFFFF          // GL state cache unknown id value, next call is issued
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Batch uniforms uploaded to a shader program
+typedef struct rlShaderUniformCache {
+    unsigned int id;                        // Shader program id (0 if cache entry not used)
+    int locs[RL_SHADER_LOC_MAP_DIFFUSE + 1];    // Shader locations used on upload
+    rlMatrix mvp;                           // Uploaded model-view-projection matrix
+    rlMatrix projection;                    // Uploaded projection matrix
+    rlMatrix view;                          // Uploaded view matrix
+    rlMatrix model;                         // Uploaded model matrix
+    rlMatrix transform;                     // rlTransform matrix used to compute uploaded normal matrix
+} rlShaderUniformCache;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1062,6 +1282,10 @@ typedef struct rlglData {
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        unsigned int multiTextureShaderId;  // Multi-texture batch shader id, replaces default shader on multi-texture batches (loaded on first use)
+        int *multiTextureShaderLocs;        // Multi-texture batch shader locations pointer
+        int multiTextureSlots;              // Multi-texture batch texture slots available (limited by texture units)
+        unsigned int currentTextureId;      // Current texture set by rlSetTexture() (0 if no texture set)
 
         bool stereoRender;                  // Stereo rendering flag
         rlMatrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
@@ -1083,7 +1307,41 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        // Deferred draw variables
+        bool deferredDraw;                  // Deferred draw mode enabled, batch draws sorted by state on batch drawing
+        int drawLayer;                      // Current draw layer (sorted first)
+        float drawDepth;                    // Current draw depth (sorted after texture, back to front)
+        unsigned char *deferredData;        // Scratch memory used to reorder batch vertex data
+        int deferredDataSize;               // Scratch memory size in bytes
+
     } State;            // Renderer state
+    struct {
+        unsigned int program;               // Shader program in use
+        int activeTextureUnit;              // Active texture unit (-1 if unknown)
+        unsigned int texture2D[RL_STATE_CACHE_TEXTURE_UNITS];  // 2D textures bound to texture units
+        int blendSrcRGB;                    // Blending source RGB factor set
+        int blendDstRGB;                    // Blending destination RGB factor set
+        int blendSrcAlpha;                  // Blending source alpha factor set
+        int blendDstAlpha;                  // Blending destination alpha factor set
+        int blendEquationRGB;               // Blending equation for RGB set
+        int blendEquationAlpha;             // Blending equation for alpha set
+        rlShaderUniformCache shaders[RL_STATE_CACHE_SHADERS];  // Batch uniforms uploaded per shader program
+        int nextShader;                     // Next shader uniforms cache entry to replace
+
+        unsigned int callsIssued;           // OpenGL calls issued through state cache
+        unsigned int callsSkipped;          // OpenGL calls skipped by state cache (redundant)
+    } Cache;            // GL state cache, redundant OpenGL calls skipped
+    struct {
+        unsigned int shaderId;              // Sprite batch shader id, expands instances into quads (loaded on first use)
+        int *shaderLocs;                    // Sprite batch shader locations pointer
+        int attribLocs[5];                  // Sprite batch attributes locations: corner, dest, source, transform, color
+        unsigned int vaoId;                 // Sprite batch vertex array id (if supported)
+        unsigned int vboId[2];              // Sprite batch vertex buffers: quad corners (static) and instances (dynamic)
+        rlSpriteInstance *instances;        // Sprite instances waiting to be drawn
+        int instanceCount;                  // Sprite instances counter
+        unsigned int textureId;             // Sprite instances texture id
+        bool failed;                        // Sprite batch loading failed, immediate mode used for sprites
+    } Sprites;          // Instanced sprites batch
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -1101,6 +1359,8 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // rlShader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage and persistent mapping support (GL_ARB_buffer_storage + GL_ARB_sync)
+        bool timerQuery;                    // GPU timestamp queries support (GL_ARB_timer_query)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1110,6 +1370,29 @@ typedef struct rlglData {
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+#if defined(GRAPHICS_API_NULL)
+// Null graphics backend shader or program object
+// NOTE: Source code is kept to find declared uniforms and attributes, programs keep linked shaders code
+typedef struct rlNullShader {
+    unsigned int id;                // Shader or program id
+    unsigned int type;              // Shader type (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER...), 0 for programs
+    unsigned int program;           // Program the shader is attached to (0 if not attached)
+    char *code;                     // Shader source code (program: linked shaders source code)
+    char *vertexCode;               // Program: linked vertex shaders source code (vertex attributes declarations)
+} rlNullShader;
+
+// Null graphics backend data
+typedef struct rlNullData {
+    rlRecordStats stats;            // Recorded commands stats
+    rlRecordCommand *commands;      // Recorded commands stream
+    rlNullShader *shaders;          // Shaders and programs objects
+    int shaderCount;                // Shaders and programs objects count
+    unsigned int nextId;            // Next object id generated (buffers, textures, shaders...)
+    int viewport[4];                // Current viewport
+    unsigned int framebuffer;       // Current framebuffer bound
+} rlNullData;
+#endif
+
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 //----------------------------------------------------------------------------------
@@ -1118,10 +1401,16 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
 static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
+static rlProfileScopeCallback rlProfileScope = NULL;    // Profiling scope callback, set by user
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+static rlNullData RLNULL = { 0 };
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1143,8 +1432,46 @@ static void rlUnloadShaderDefault(void);    // Unload default shader
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
+static void *rlLoadBatchVertexBuffer(unsigned int *id, int size, void *data, unsigned int flags);   // Load render batch vertex buffer into GPU
+static void rlUpdateBatchVertexBuffer(unsigned int id, const void *data, int dataSize, int bufferSize, bool orphan); // Update render batch vertex buffer
+static void rlSetBatchVertexAttribs(const rlVertexBuffer *buffer, unsigned int flags);  // Set render batch vertex attributes for current shader
+static void rlEnableBatchShader(unsigned int id, int *locs);    // Enable shader for batch drawing, uploading current matrices
+static void rlApplyBlendMode(int mode);                         // Apply blend mode to OpenGL blending state
+static void rlDeferredDrawStateChange(void);                    // Register a new draw on deferred draw mode state change
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b);    // Compare draws state for deferred draw sorting
+static void rlSortRenderBatchDraws(rlRenderBatch *batch);       // Sort render batch draws by state, merging draws with same state
+static void rlLoadShaderMultiTexture(void);                     // Load multi-texture batch shader
+static void rlSetBatchTextureSlot(unsigned int id);             // Assign texture to a texture slot of current multi-texture batch
+static void rlCopyBatchVertices(const rlCommandList *list, int first, int count);   // Copy command list vertex data into current render batch buffer
+static void rlTransformBatchNormal(float *normal);              // Transform normal by current rlgl transform and normalize it (as rlNormal3f())
+static void rlLoadSpriteBatch(void);                            // Load instanced sprites batch (shader and vertex buffers)
+static void rlUnloadSpriteBatch(void);                          // Unload instanced sprites batch
+static void rlSetSpriteBatchVertexAttribs(void);                // Set instanced sprites batch vertex attributes
+static void rlDrawSpriteBatch(void);                            // Draw instanced sprites batch (Update->Draw->Reset)
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static void rlCacheUseProgram(unsigned int id);         // Use shader program, skipped if already in use
+static void rlCacheActiveTexture(int unit);             // Select active texture unit, skipped if already active
+static void rlCacheBindTexture2D(unsigned int id);      // Bind 2D texture to active texture unit, skipped if already bound
+static void rlCacheDeleteTexture(unsigned int id);      // Remove deleted texture from state cache
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlCacheDeleteProgram(unsigned int id);      // Remove deleted shader program from state cache
+static void rlCacheUniformsModified(void);              // Register uniforms modification for shader program in use
+static void rlCacheUniformMatrix(int location, rlMatrix *uploaded, rlMatrix mat, bool force);   // Upload matrix uniform, skipped if same matrix already uploaded
+static void rlCacheBlendFunc(int srcRGB, int dstRGB, int srcAlpha, int dstAlpha);   // Set blending factors, skipped if already set
+static void rlCacheBlendEquation(int equationRGB, int equationAlpha);   // Set blending equations, skipped if already set
+#endif
+
+#if defined(GRAPHICS_API_NULL)
+static void rlNullRecord(int type, unsigned int id, int count, int instances, int size); // Register recorded command into stats and command stream
+static GLADapiproc rlNullGetProcAddress(const char *name);  // Get null OpenGL function address by name (glad loader)
+static unsigned int rlNullAddShader(unsigned int id, unsigned int type);    // Add null shader or program object
+static rlNullShader *rlNullGetShader(unsigned int id);      // Get null shader or program object by id
+static void rlNullDeleteObject(unsigned int id);            // Delete null shader or program object
+static bool rlNullIsNameChar(char c);                       // Check if character is part of a GLSL identifier
+static int rlNullFindDeclaration(const char *code, const char *qualifier, const char *name);    // Find variable declared in shader code
+#endif
+
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
 // Auxiliar matrix math functions
@@ -1157,6 +1484,7 @@ static rlMatrix rlMatrixIdentity(void);                       // Get identity ma
 static rlMatrix rlMatrixMultiply(rlMatrix left, rlMatrix right);  // Multiply two matrices
 static rlMatrix rlMatrixTranspose(rlMatrix mat);                // Transposes provided matrix
 static rlMatrix rlMatrixInvert(rlMatrix mat);                   // Invert provided matrix
+static rlMatrix rlMatrixRotate(float angle, float x, float y, float z); // Get rotation matrix, angle in degrees
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - rlMatrix operations
@@ -1261,42 +1589,7 @@ void rlTranslatef(float x, float y, float z)
 // NOTE: The provided angle must be in degrees
 void rlRotatef(float angle, float x, float y, float z)
 {
-    rlMatrix matRotation = rlMatrixIdentity();
-
-    // Axis vector (x, y, z) normalization
-    float lengthSquared = x*x + y*y + z*z;
-    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
-    {
-        float inverseLength = 1.0f/sqrtf(lengthSquared);
-        x *= inverseLength;
-        y *= inverseLength;
-        z *= inverseLength;
-    }
-
-    // Rotation matrix generation
-    float sinres = sinf(DEG2RAD*angle);
-    float cosres = cosf(DEG2RAD*angle);
-    float t = 1.0f - cosres;
-
-    matRotation.m0 = x*x*t + cosres;
-    matRotation.m1 = y*x*t + z*sinres;
-    matRotation.m2 = z*x*t - y*sinres;
-    matRotation.m3 = 0.0f;
-
-    matRotation.m4 = x*y*t - z*sinres;
-    matRotation.m5 = y*y*t + cosres;
-    matRotation.m6 = z*y*t + x*sinres;
-    matRotation.m7 = 0.0f;
-
-    matRotation.m8 = x*z*t + y*sinres;
-    matRotation.m9 = y*z*t - x*sinres;
-    matRotation.m10 = z*z*t + cosres;
-    matRotation.m11 = 0.0f;
-
-    matRotation.m12 = 0.0f;
-    matRotation.m13 = 0.0f;
-    matRotation.m14 = 0.0f;
-    matRotation.m15 = 1.0f;
+    rlMatrix matRotation = rlMatrixRotate(angle, x, y, z);
 
     // NOTE: We transpose matrix with multiplication order
     *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
@@ -1449,6 +1742,12 @@ void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    // Instanced sprites were submitted before, they must be drawn first
+    if (RLGL.Sprites.instanceCount > 0) rlDrawSpriteBatch();
+
+    // Multi-texture batch: vertices use default texture slot if no texture is set
+    if ((RLGL.currentBatch->flags & RL_BATCH_MULTI_TEXTURE) && (RLGL.State.currentTextureId == 0)) rlSetBatchTextureSlot(RLGL.State.defaultTextureId);
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1529,25 +1828,77 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
-    // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+    // Register current state on the first vertex of the draw
+    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount == 0)
+    {
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].shaderId = RLGL.State.currentShaderId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].shaderLocs = RLGL.State.currentShaderLocs;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].blendMode = RLGL.State.currentBlendMode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].depth = RLGL.State.drawDepth;
+    }
+
+    if (RLGL.currentBatch->flags & RL_BATCH_INTERLEAVED)
+    {
+        // Add vertex position, current texcoord, current normal (optional) and current color
+        // NOTE: Attributes are copied with memcpy(), interleaved vertex data is not aligned to float size
+        unsigned char *vertex = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].interleaved +
+            RLGL.State.vertexCounter*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertexStride;
+
+        float position[3] = { tx, ty, tz };
+        memcpy(vertex, position, sizeof(position));
+        vertex += sizeof(position);
+
+        if (RLGL.currentBatch->flags & RL_BATCH_TEXCOORDS_HALF)
+        {
+            unsigned short texcoord[2] = { rlFloatToHalf(RLGL.State.texcoordx), rlFloatToHalf(RLGL.State.texcoordy) };
+            memcpy(vertex, texcoord, sizeof(texcoord));
+            vertex += sizeof(texcoord);
+        }
+        else
+        {
+            float texcoord[2] = { RLGL.State.texcoordx, RLGL.State.texcoordy };
+            memcpy(vertex, texcoord, sizeof(texcoord));
+            vertex += sizeof(texcoord);
+        }
 
-    // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+        if (!(RLGL.currentBatch->flags & RL_BATCH_NO_NORMALS))
+        {
+            float normal[3] = { RLGL.State.normalx, RLGL.State.normaly, RLGL.State.normalz };
+            memcpy(vertex, normal, sizeof(normal));
+            vertex += sizeof(normal);
+        }
 
-    // Add current normal
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
+        vertex[0] = RLGL.State.colorr;
+        vertex[1] = RLGL.State.colorg;
+        vertex[2] = RLGL.State.colorb;
+        vertex[3] = RLGL.State.colora;
 
-    // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+        // Add current texture slot (padded to 4 bytes)
+        if (RLGL.currentBatch->flags & RL_BATCH_MULTI_TEXTURE) vertex[4] = (unsigned char)RLGL.currentBatch->currentTextureSlot;
+    }
+    else
+    {
+        // Add vertices
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+
+        // Add current texcoord
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+
+        // Add current normal
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
+
+        // Add current color
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    }
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1640,6 +1991,11 @@ void rlSetTexture(unsigned int id)
         {
             rlDrawRenderBatch(RLGL.currentBatch);
         }
+
+        // Multi-texture batch: next vertices use default texture slot
+        if (RLGL.currentBatch->flags & RL_BATCH_MULTI_TEXTURE) rlSetBatchTextureSlot(RLGL.State.defaultTextureId);
+
+        RLGL.State.currentTextureId = 0;
 #endif
     }
     else
@@ -1647,7 +2003,19 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        bool textureSlotted = false;
+
+        RLGL.State.currentTextureId = id;
+
+        // Multi-texture batch: texture assigned to a texture slot referenced by next vertices,
+        // no new draw required unless a custom shader is used (only texture0 available)
+        if (RLGL.currentBatch->flags & RL_BATCH_MULTI_TEXTURE)
+        {
+            rlSetBatchTextureSlot(id);
+            textureSlotted = (RLGL.State.currentShaderId == RLGL.State.defaultShaderId);
+        }
+
+        if (!textureSlotted && (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id))
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
@@ -1681,7 +2049,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(slot);
 #endif
 }
 
@@ -1691,7 +2059,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 }
 
 // Disable texture
@@ -1700,7 +2068,7 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 }
 
 // Enable texture cubemap
@@ -1722,7 +2090,7 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1764,7 +2132,7 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1815,7 +2183,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1823,7 +2191,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 #endif
 }
 
@@ -2096,33 +2464,22 @@ void rlCheckErrors(void)
 void rlSetBlendMode(int mode)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
+    if (RLGL.State.deferredDraw && (mode != RL_BLEND_CUSTOM) && (mode != RL_BLEND_CUSTOM_SEPARATE) &&
+        (RLGL.State.currentBlendMode != RL_BLEND_CUSTOM) && (RLGL.State.currentBlendMode != RL_BLEND_CUSTOM_SEPARATE))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-
-        switch (mode)
+        // Deferred draw mode: blend mode is registered by the draw and applied on batch drawing
+        // NOTE: Custom blend modes still force a batch draw, blend factors are not registered by draws
+        if (RLGL.State.currentBlendMode != mode)
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
-
-            } break;
-            default: break;
+            rlDeferredDrawStateChange();
+            RLGL.State.currentBlendMode = mode;
         }
+    }
+    else if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        rlApplyBlendMode(mode);
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
@@ -2252,6 +2609,9 @@ void rlglInit(int width, int height)
     }
 #endif
 
+    // Init GL state cache, OpenGL state is unknown
+    rlInvalidateStateCache();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
@@ -2269,7 +2629,8 @@ void rlglInit(int width, int height)
     // Init default vertex arrays buffers
     // Simulate that the default shader has the location RL_SHADER_LOC_VERTEX_NORMAL to bind the normal buffer for the default render batch
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    if (RL_DEFAULT_BATCH_FLAGS & RL_BATCH_PERSISTENT_MAPPED) RLGL.defaultBatch = rlLoadRenderBatchEx(RL_DEFAULT_BATCH_RING_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_DEFAULT_BATCH_FLAGS);
+    else RLGL.defaultBatch = rlLoadRenderBatchEx(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_DEFAULT_BATCH_FLAGS);
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
     RLGL.currentBatch = &RLGL.defaultBatch;
 
@@ -2331,21 +2692,59 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    RL_FREE(RLGL.State.deferredData);   // Unload deferred draw scratch memory
+    RLGL.State.deferredData = NULL;
+    RLGL.State.deferredDataSize = 0;
+
     rlUnloadShaderDefault();          // Unload default shader
 
+    if (RLGL.State.multiTextureShaderId > 0)
+    {
+        rlCacheDeleteProgram(RLGL.State.multiTextureShaderId);
+        glDeleteProgram(RLGL.State.multiTextureShaderId);     // Unload multi-texture batch shader
+        RL_FREE(RLGL.State.multiTextureShaderLocs);
+        RLGL.State.multiTextureShaderId = 0;
+    }
+
+    rlUnloadSpriteBatch();            // Unload instanced sprites batch
+
+    rlCacheDeleteTexture(RLGL.State.defaultTextureId);
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+#if defined(GRAPHICS_API_NULL)
+    RL_FREE(RLNULL.commands);           // Unload recorded commands stream
+    RLNULL.commands = NULL;
+
+    for (int i = 0; i < RLNULL.shaderCount; i++)
+    {
+        RL_FREE(RLNULL.shaders[i].code);
+        RL_FREE(RLNULL.shaders[i].vertexCode);
+    }
+    RL_FREE(RLNULL.shaders);            // Unload shaders and programs objects
+    RLNULL.shaders = NULL;
+    RLNULL.shaderCount = 0;
+#endif
 }
 
 // Load OpenGL extensions
 // NOTE: External loader function must be provided
 void rlLoadExtensions(void *loader)
 {
-#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+#if defined(GRAPHICS_API_NULL)
+    // NOTE: Provided loader is ignored, null OpenGL functions are loaded
+    if (RLNULL.commands == NULL) RLNULL.commands = (rlRecordCommand *)RL_CALLOC(RL_NULL_MAX_RECORD_COMMANDS, sizeof(rlRecordCommand));
+    RLNULL.nextId = 1;
+
+    if (gladLoadGL((GLADloadfunc)rlNullGetProcAddress) == 0) TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load null OpenGL functions");
+    else TRACELOG(RL_LOG_INFO, "GLAD: Null OpenGL functions loaded successfully (recording)");
+#elif defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
     if (gladLoadGL((GLADloadfunc)loader) == 0) TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
     else TRACELOG(RL_LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
 
     // Get number of supported extensions
     GLint numExt = 0;
@@ -2393,6 +2792,8 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glFenceSync != NULL);
+    RLGL.ExtSupported.timerQuery = (glQueryCounter != NULL) && (glGetQueryObjectui64v != NULL);   // Core on OpenGL 3.3, GL_ARB_timer_query on OpenGL 2.1
 
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2602,6 +3003,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: rlShader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2697,26 +3099,217 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Invalidate GL state cache
+// NOTE: Required if OpenGL state is modified outside rlgl, next calls are issued
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.program = RL_STATE_CACHE_UNKNOWN;
+    RLGL.Cache.activeTextureUnit = -1;
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++) RLGL.Cache.texture2D[i] = RL_STATE_CACHE_UNKNOWN;
+
+    RLGL.Cache.blendSrcRGB = -1;
+    RLGL.Cache.blendDstRGB = -1;
+    RLGL.Cache.blendSrcAlpha = -1;
+    RLGL.Cache.blendDstAlpha = -1;
+    RLGL.Cache.blendEquationRGB = -1;
+    RLGL.Cache.blendEquationAlpha = -1;
+
+    for (int i = 0; i < RL_STATE_CACHE_SHADERS; i++) RLGL.Cache.shaders[i].id = 0;
+    RLGL.Cache.nextShader = 0;
+#endif
+}
+
+// Get GL state cache calls issued and skipped
+void rlGetStateCacheCounters(unsigned int *issued, unsigned int *skipped)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (issued != NULL) *issued = RLGL.Cache.callsIssued;
+    if (skipped != NULL) *skipped = RLGL.Cache.callsSkipped;
+#else
+    if (issued != NULL) *issued = 0;
+    if (skipped != NULL) *skipped = 0;
+#endif
+}
+
+// Reset GL state cache calls counters
+void rlResetStateCacheCounters(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.callsIssued = 0;
+    RLGL.Cache.callsSkipped = 0;
+#endif
+}
+
+// Get recorded commands stats (null graphics backend)
+rlRecordStats rlGetRecordStats(void)
+{
+    rlRecordStats stats = { 0 };
+#if defined(GRAPHICS_API_NULL)
+    stats = RLNULL.stats;
+#endif
+    return stats;
+}
+
+// Get recorded commands stream (null graphics backend)
+// NOTE: Commands are recorded until RL_NULL_MAX_RECORD_COMMANDS, stats keep counting
+const rlRecordCommand *rlGetRecordCommands(int *count)
+{
+    const rlRecordCommand *commands = NULL;
+    if (count != NULL) *count = 0;
+#if defined(GRAPHICS_API_NULL)
+    commands = RLNULL.commands;
+    if (count != NULL) *count = (int)RLNULL.stats.commandCount;
+#endif
+    return commands;
+}
+
+// Reset recorded commands stream and stats (null graphics backend)
+void rlResetRecord(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    rlRecordStats stats = { 0 };
+    RLNULL.stats = stats;
+
+    if (RLNULL.commands != NULL) memset(RLNULL.commands, 0, RL_NULL_MAX_RECORD_COMMANDS*sizeof(rlRecordCommand));
+#endif
+}
+
+// Load GPU timer query object
+unsigned int rlLoadTimerQuery(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.timerQuery) glGenQueries(1, &id);
+#endif
+    return id;
+}
+
+// Unload GPU timer query object
+void rlUnloadTimerQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (id > 0) glDeleteQueries(1, &id);
+#endif
+}
+
+// Record GPU timestamp into query
+// NOTE: Timestamp is registered once all previous commands have been completed by GPU
+void rlQueryTimestamp(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (id > 0) glQueryCounter(id, GL_TIMESTAMP);
+#endif
+}
+
+// Get GPU timestamp in nanoseconds
+// NOTE: Non-blocking, returns false if result is not available yet
+bool rlGetTimerQueryResult(unsigned int id, unsigned long long int *timestamp)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (id > 0)
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(id, GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available)
+        {
+            GLuint64 value = 0;
+            glGetQueryObjectui64v(id, GL_QUERY_RESULT, &value);
+            *timestamp = (unsigned long long int)value;
+            result = true;
+        }
+    }
+#endif
+    return result;
+}
+
+// Set profiling scope callback
+// NOTE: Called with the scope name on begin and end, set NULL to disable
+void rlSetProfileScopeCallback(rlProfileScopeCallback callback)
+{
+    rlProfileScope = callback;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchEx(numBuffers, bufferElements, 0);
+}
+
+// Load render batch with flags (rlRenderBatchFlags)
+// NOTE: With RL_BATCH_PERSISTENT_MAPPED, every vertex buffer is an entry of a ring: CPU vertex arrays point
+// directly to persistently mapped GPU memory and a fence is waited before an entry is written again
+rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, unsigned int flags)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((flags & RL_BATCH_PERSISTENT_MAPPED) && !RLGL.ExtSupported.bufferStorage)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Persistent mapped buffers not supported, using buffer orphaning");
+        flags = (flags & ~RL_BATCH_PERSISTENT_MAPPED) | RL_BATCH_ORPHAN_UPLOAD;
+    }
+
+    if ((flags & (RL_BATCH_TEXCOORDS_HALF | RL_BATCH_NO_NORMALS)) && !(flags & RL_BATCH_INTERLEAVED))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Compact vertex formats require interleaved render batch, using default vertex format");
+        flags &= ~(RL_BATCH_TEXCOORDS_HALF | RL_BATCH_NO_NORMALS);
+    }
+
+    if ((flags & RL_BATCH_MULTI_TEXTURE) && !(flags & RL_BATCH_INTERLEAVED))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Multi-texture render batch requires interleaved vertex format, using one texture per draw");
+        flags &= ~RL_BATCH_MULTI_TEXTURE;
+    }
+
+    if ((flags & RL_BATCH_MULTI_TEXTURE) && (RLGL.State.multiTextureShaderId == 0))
+    {
+        rlLoadShaderMultiTexture();
+        if (RLGL.State.multiTextureShaderId == 0) flags &= ~RL_BATCH_MULTI_TEXTURE;
+    }
+
+// NOTE: OpenGL ES 2.0 only provides GL_HALF_FLOAT_OES (OES_vertex_half_float extension), float texcoords used
+#if !defined(GL_HALF_FLOAT) || defined(GRAPHICS_API_OPENGL_21) || (defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3))
+    if (flags & RL_BATCH_TEXCOORDS_HALF)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Half float vertex attributes not supported, using float texcoords");
+        flags &= ~RL_BATCH_TEXCOORDS_HALF;
+    }
+#endif
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        // NOTE: Persistent mapped vertex arrays are mapped on GPU buffers creation
+        if (flags & RL_BATCH_INTERLEAVED)
+        {
+            // Vertex size: 3 float position + 2 float/half texcoord + 3 float normal (optional) + 4 unsigned char color + 4 unsigned char texture slot (optional)
+            batch.vertexBuffer[i].vertexStride = 3*sizeof(float) + ((flags & RL_BATCH_TEXCOORDS_HALF)? 2*sizeof(unsigned short) : 2*sizeof(float)) +
+                ((flags & RL_BATCH_NO_NORMALS)? 0 : 3*sizeof(float)) + 4*sizeof(unsigned char) + ((flags & RL_BATCH_MULTI_TEXTURE)? 4*sizeof(unsigned char) : 0);
+
+            if (!(flags & RL_BATCH_PERSISTENT_MAPPED)) batch.vertexBuffer[i].interleaved = (unsigned char *)RL_CALLOC(bufferElements*4, batch.vertexBuffer[i].vertexStride);
+        }
+        else if (!(flags & RL_BATCH_PERSISTENT_MAPPED))
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2724,11 +3317,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2762,33 +3350,27 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         }
 
         // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (flags & RL_BATCH_INTERLEAVED)
+        {
+            // Vertex interleaved buffer (shader-location = 0, 1, 2, 3)
+            batch.vertexBuffer[i].interleaved = (unsigned char *)rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*4*batch.vertexBuffer[i].vertexStride, batch.vertexBuffer[i].interleaved, flags);
+        }
+        else
+        {
+            // Vertex position buffer (shader-location = 0)
+            batch.vertexBuffer[i].vertices = (float *)rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, flags);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            batch.vertexBuffer[i].texcoords = (float *)rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[1], bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, flags);
+
+            // Vertex normal buffer (shader-location = 2)
+            batch.vertexBuffer[i].normals = (float *)rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[2], bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, flags);
+
+            // Vertex color buffer (shader-location = 3)
+            batch.vertexBuffer[i].colors = (unsigned char *)rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[3], bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, flags);
+        }
+
+        rlSetBatchVertexAttribs(&batch.vertexBuffer[i], flags);
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
@@ -2801,7 +3383,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #endif
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (flags & RL_BATCH_PERSISTENT_MAPPED) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers mapped persistently in VRAM (GPU) [%i buffers ring]", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2826,6 +3409,10 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     batch.bufferCount = numBuffers;    // Record buffer count
     batch.drawCounter = 1;             // Reset draws counter
     batch.currentDepth = -1.0f;         // Reset depth value
+    batch.flags = flags;               // Record flags in use
+    batch.textureSlots[0] = RLGL.State.defaultTextureId;  // First texture slot used by default texture
+    batch.textureSlotCount = 1;
+    batch.currentTextureSlot = 0;
     //--------------------------------------------------------------------------------------------
 #endif
 
@@ -2864,11 +3451,19 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Delete pending fence, persistent mapped vertex arrays are unmapped on buffers deletion
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        if (!(batch.flags & RL_BATCH_PERSISTENT_MAPPED))
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].normals);
+            RL_FREE(batch.vertexBuffer[i].colors);
+            RL_FREE(batch.vertexBuffer[i].interleaved);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2882,50 +3477,43 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
+    if (rlProfileScope != NULL) rlProfileScope("rlDrawRenderBatch", true);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Draw pending instanced sprites, batch vertex can't be added after them without drawing them first
+    if (RLGL.Sprites.instanceCount > 0) rlDrawSpriteBatch();
+
+    // Sort and merge batch draws by state in deferred draw mode
+    // NOTE: Persistent mapped vertex data is write-only GPU memory, it can not be read back for reordering
+    if (RLGL.State.deferredDraw && (RLGL.State.vertexCounter > 0) && !(batch->flags & RL_BATCH_PERSISTENT_MAPPED)) rlSortRenderBatchDraws(batch);
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+    // NOTE: Persistent mapped buffers already contain the vertex data written by rlVertex3f()
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    if ((RLGL.State.vertexCounter > 0) && !(batch->flags & RL_BATCH_PERSISTENT_MAPPED))
     {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        bool orphan = (batch->flags & RL_BATCH_ORPHAN_UPLOAD);
+
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // rlTexture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+        if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId);
+
+        // NOTE: Orphaning the buffer storage with glBufferData(NULL) lets the driver allocate a new
+        // storage immediately, instead of stalling until GPU finishes working with the previous data
+        if (batch->flags & RL_BATCH_INTERLEAVED)
+        {
+            // Interleaved vertex buffer, all vertex data uploaded at once
+            rlUpdateBatchVertexBuffer(buffer->vboId[0], buffer->interleaved, RLGL.State.vertexCounter*buffer->vertexStride, buffer->elementCount*4*buffer->vertexStride, orphan);
+        }
+        else
+        {
+            rlUpdateBatchVertexBuffer(buffer->vboId[0], buffer->vertices, RLGL.State.vertexCounter*3*sizeof(float), buffer->elementCount*4*3*sizeof(float), orphan);       // Vertex positions buffer
+            rlUpdateBatchVertexBuffer(buffer->vboId[1], buffer->texcoords, RLGL.State.vertexCounter*2*sizeof(float), buffer->elementCount*4*2*sizeof(float), orphan);      // rlTexture coordinates buffer
+            rlUpdateBatchVertexBuffer(buffer->vboId[2], buffer->normals, RLGL.State.vertexCounter*3*sizeof(float), buffer->elementCount*4*3*sizeof(float), orphan);        // Normals buffer
+            rlUpdateBatchVertexBuffer(buffer->vboId[3], buffer->colors, RLGL.State.vertexCounter*4*sizeof(unsigned char), buffer->elementCount*4*4*sizeof(unsigned char), orphan);  // Colors buffer
+        }
 
         // Unbind the current VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2956,85 +3544,76 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Draw buffers
         if (RLGL.State.vertexCounter > 0)
         {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            // Set current shader and upload current matrices
+            // NOTE: Multi-texture batches replace default shader by multi-texture batch shader
+            bool multiTexture = (batch->flags & RL_BATCH_MULTI_TEXTURE);
+            unsigned int shaderId = RLGL.State.currentShaderId;
+            int blendMode = -1;     // Deferred draws blend mode applied (-1 if not applied yet)
 
-            // Create modelview-projection matrix and upload to shader
-            rlMatrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            // NOTE: In deferred draw mode shader is enabled by the draws, starting with the first one
+            if (RLGL.State.deferredDraw) shaderId = 0;
+            else if (multiTexture && (shaderId == RLGL.State.defaultShaderId)) rlEnableBatchShader(RLGL.State.multiTextureShaderId, RLGL.State.multiTextureShaderLocs);
+            else rlEnableBatchShader(shaderId, RLGL.State.currentShaderLocs);
 
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
-            }
+                // Bind vertex attribs: position, texcoord, normal, color (shader-location = 0, 1, 2, 3)
+                rlSetBatchVertexAttribs(&batch->vertexBuffer[batch->currentBuffer], batch->flags);
 
-            // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
-            // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+            }
 
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+            // Activate additional sampler textures
+            // Those additional textures will be common for all draw calls of the batch
+            for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                if (RLGL.State.activeTextureId[i] > 0)
+                {
+                    rlCacheActiveTexture(1 + i);
+                    rlCacheBindTexture2D(RLGL.State.activeTextureId[i]);
+                }
             }
 
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+            // Activate multi-texture batch texture slots, bound after additional sampler textures units
+            // NOTE: Only required if default shader is used, it could be used by any draw in deferred draw mode
+            if (multiTexture && (RLGL.State.deferredDraw || (shaderId == RLGL.State.defaultShaderId)))
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
-            }
-
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
-            }
-
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
-
-            // Activate additional sampler textures
-            // Those additional textures will be common for all draw calls of the batch
-            for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
-            {
-                if (RLGL.State.activeTextureId[i] > 0)
-                {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
-                }
+                for (int i = 0; i < batch->textureSlotCount; i++)
+                {
+                    rlCacheActiveTexture(RL_BATCH_TEXTURE_SLOT_UNIT(i));
+                    rlCacheBindTexture2D(batch->textureSlots[i]);
+                }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlCacheActiveTexture(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Deferred draw mode: enable draw call shader and blend mode if changed
+                if (RLGL.State.deferredDraw && (batch->draws[i].vertexCount > 0))
+                {
+                    if (batch->draws[i].shaderId != shaderId)
+                    {
+                        shaderId = batch->draws[i].shaderId;
+
+                        if (multiTexture && (shaderId == RLGL.State.defaultShaderId)) rlEnableBatchShader(RLGL.State.multiTextureShaderId, RLGL.State.multiTextureShaderLocs);
+                        else rlEnableBatchShader(shaderId, batch->draws[i].shaderLocs);
+                    }
+
+                    if (batch->draws[i].blendMode != blendMode)
+                    {
+                        blendMode = batch->draws[i].blendMode;
+                        rlApplyBlendMode(blendMode);
+                    }
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                // NOTE: Multi-texture draws use texture slots, texture0 is first texture slot
+                if (multiTexture && (batch->draws[i].shaderId == RLGL.State.defaultShaderId)) rlCacheBindTexture2D(batch->textureSlots[0]);
+                else rlCacheBindTexture2D(batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3058,19 +3637,30 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
-
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        // NOTE: Shader program and textures are kept bound for next batch drawing, rebinding them is
+        // skipped by GL state cache, user code mixing OpenGL calls must call rlInvalidateStateCache()
     }
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    // Restore current blend mode, not applied on change in deferred draw mode
+    if (RLGL.State.deferredDraw) rlApplyBlendMode(RLGL.State.currentBlendMode);
     //------------------------------------------------------------------------------------------------------------
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence the persistent mapped buffer just submitted, it can't be written until GPU is done with it
+    // NOTE: Nothing to guard if no vertex data was drawn from the buffer
+    if ((batch->flags & RL_BATCH_PERSISTENT_MAPPED) && (RLGL.State.vertexCounter > 0) && (batch->vertexBuffer[batch->currentBuffer].fence == NULL))
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
@@ -3094,6 +3684,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
+    // Reset texture slots, first slot used by default texture
+    batch->textureSlots[0] = RLGL.State.defaultTextureId;
+    batch->textureSlotCount = 1;
+    batch->currentTextureSlot = 0;
+
     // Reset draws counter to one draw for the batch
     batch->drawCounter = 1;
     //------------------------------------------------------------------------------------------------------------
@@ -3101,7 +3696,27 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Wait for GPU to release next persistent mapped buffer before writing into it
+    // NOTE: With enough buffers in the ring this fence is already signaled
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        while ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED) && (result != GL_WAIT_FAILED))
+        {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // Wait up to 1 ms per try
+        }
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
+
+    if (rlProfileScope != NULL) rlProfileScope("rlDrawRenderBatch", false);
 }
 
 // Set the active render batch for rlgl
@@ -3138,18 +3753,450 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        unsigned int currentSlotTexture = RLGL.currentBatch->textureSlots[RLGL.currentBatch->currentTextureSlot];
 
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        RLGL.currentBatch->textureSlots[0] = currentSlotTexture;
     }
 #endif
 
     return overflow;
 }
 
+// Enable deferred draw mode
+// NOTE: Shader, blend mode and layer changes register new draws instead of drawing the batch,
+// draws are sorted by (layer, shader, blend mode, texture, depth) and merged when the batch is drawn.
+// Submission order is kept for draws sharing the same state, use layers where painter's order is required
+// and depth to sort translucent draws back to front inside a layer
+// WARNING: Draws are not sorted on persistent mapped batches (write-only GPU memory), submission order is used
+void rlEnableDeferredDraw(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.deferredDraw = true;
+#endif
+}
+
+// Disable deferred draw mode
+void rlDisableDeferredDraw(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.deferredDraw)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);   // Draw deferred draws, restoring current blend mode
+        RLGL.State.deferredDraw = false;
+    }
+#endif
+}
+
+// Set current draw layer
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawLayer != layer)
+    {
+        if (RLGL.State.deferredDraw) rlDeferredDrawStateChange();
+        RLGL.State.drawLayer = layer;
+    }
+#endif
+}
+
+// Set current draw depth
+// NOTE: Depth is an explicit sort key, vertex z coordinate is not used
+void rlSetDrawDepth(float depth)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawDepth != depth)
+    {
+        if (RLGL.State.deferredDraw) rlDeferredDrawStateChange();
+        RLGL.State.drawDepth = depth;
+    }
+#endif
+}
+
+// Add sprite to instanced sprite batch, quad vertex are generated on GPU
+// NOTE: Only available with default shader and default render batch, out of deferred draw mode, stereo rendering
+// and matrix transforms (rlPushMatrix()), returns false if sprite must be drawn in immediate mode
+bool rlDrawSpriteInstance(unsigned int textureId, const rlSpriteInstance *sprite)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.instancing && !RLGL.Sprites.failed && !RLGL.State.deferredDraw && !RLGL.State.stereoRender &&
+        !RLGL.State.transformRequired && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) &&
+        (RLGL.currentBatch == &RLGL.defaultBatch))
+    {
+        if (RLGL.Sprites.shaderId == 0) rlLoadSpriteBatch();
+
+        if (!RLGL.Sprites.failed)
+        {
+            // Keep submission order, batch vertex submitted before sprites are drawn first
+            if (RLGL.State.vertexCounter > 0) rlDrawRenderBatch(RLGL.currentBatch);
+
+            if ((RLGL.Sprites.instanceCount > 0) &&
+                ((RLGL.Sprites.textureId != textureId) || (RLGL.Sprites.instanceCount >= RL_SPRITE_BATCH_INSTANCES))) rlDrawSpriteBatch();
+
+            rlSpriteInstance *instance = &RLGL.Sprites.instances[RLGL.Sprites.instanceCount];
+            *instance = *sprite;
+            instance->transform[3] = RLGL.currentBatch->currentDepth;
+
+            // NOTE: Same depth increment as rlEnd()
+            RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+
+            RLGL.Sprites.textureId = textureId;
+            RLGL.Sprites.instanceCount++;
+            result = true;
+        }
+    }
+#endif
+
+    return result;
+}
+
+// Command lists management
+//-----------------------------------------------------------------------------------------
+// Load a command list
+// NOTE: Only CPU memory is allocated, command list can be loaded on any thread
+rlCommandList rlLoadCommandList(int vertexCapacity)
+{
+    rlCommandList list = { 0 };
+
+    if (vertexCapacity <= 0) vertexCapacity = 4*RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+
+    list.vertexCapacity = vertexCapacity;
+    list.vertices = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    list.texcoords = (float *)RL_MALLOC(vertexCapacity*2*sizeof(float));
+    list.normals = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    list.colors = (unsigned char *)RL_MALLOC(vertexCapacity*4*sizeof(unsigned char));
+
+    list.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;
+    list.draws = (rlDrawCall *)RL_MALLOC(list.drawCapacity*sizeof(rlDrawCall));
+    list.stack = (rlMatrix *)RL_MALLOC(RL_MAX_MATRIX_STACK_SIZE*sizeof(rlMatrix));
+
+    rlResetCommandList(&list);
+
+    return list;
+}
+
+// Unload command list
+void rlUnloadCommandList(rlCommandList list)
+{
+    RL_FREE(list.vertices);
+    RL_FREE(list.texcoords);
+    RL_FREE(list.normals);
+    RL_FREE(list.colors);
+    RL_FREE(list.draws);
+    RL_FREE(list.stack);
+}
+
+// Reset command list for new recording, allocated memory is kept
+void rlResetCommandList(rlCommandList *list)
+{
+    list->vertexCount = 0;
+    list->drawCounter = 0;
+
+    list->currentTexture = 0;
+    list->currentDepth = -1.0f;     // Same initial depth as render batch, required for 2D vertex
+    list->texcoordx = 0.0f;
+    list->texcoordy = 0.0f;
+    list->normalx = 0.0f;
+    list->normaly = 0.0f;
+    list->normalz = 1.0f;
+    list->colorr = 255;
+    list->colorg = 255;
+    list->colorb = 255;
+    list->colora = 255;
+
+    list->transform = rlMatrixIdentity();
+    list->stackCounter = 0;
+}
+
+// Record vertex data start
+// NOTE: A new draw is recorded if mode or texture changes, consecutive draws with same state are merged
+void rlCmdBegin(rlCommandList *list, int mode)
+{
+    if ((list->drawCounter == 0) ||
+        (list->draws[list->drawCounter - 1].mode != mode) ||
+        (list->draws[list->drawCounter - 1].textureId != list->currentTexture))
+    {
+        // Do not keep empty draws around
+        if ((list->drawCounter == 0) || (list->draws[list->drawCounter - 1].vertexCount > 0))
+        {
+            if (list->drawCounter >= list->drawCapacity)
+            {
+                list->drawCapacity *= 2;
+                list->draws = (rlDrawCall *)RL_REALLOC(list->draws, list->drawCapacity*sizeof(rlDrawCall));
+            }
+
+            list->drawCounter++;
+        }
+
+        rlDrawCall *draw = &list->draws[list->drawCounter - 1];
+        memset(draw, 0, sizeof(rlDrawCall));
+        draw->mode = mode;
+        draw->textureId = list->currentTexture;
+    }
+}
+
+// Record vertex data end
+void rlCmdEnd(rlCommandList *list)
+{
+    // NOTE: Same depth increment as rlEnd()
+    list->currentDepth += (1.0f/20000.0f);
+}
+
+// Record one vertex (position)
+// NOTE: Current transform matrix is applied on recording, current texcoord, normal and color are stored
+void rlCmdVertex3f(rlCommandList *list, float x, float y, float z)
+{
+    if (list->drawCounter == 0) return;    // Vertex out of rlCmdBegin()/rlCmdEnd()
+
+    if (list->vertexCount >= list->vertexCapacity)
+    {
+        list->vertexCapacity *= 2;
+        list->vertices = (float *)RL_REALLOC(list->vertices, list->vertexCapacity*3*sizeof(float));
+        list->texcoords = (float *)RL_REALLOC(list->texcoords, list->vertexCapacity*2*sizeof(float));
+        list->normals = (float *)RL_REALLOC(list->normals, list->vertexCapacity*3*sizeof(float));
+        list->colors = (unsigned char *)RL_REALLOC(list->colors, list->vertexCapacity*4*sizeof(unsigned char));
+    }
+
+    const rlMatrix *mat = &list->transform;
+    int i = list->vertexCount;
+
+    list->vertices[3*i] = mat->m0*x + mat->m4*y + mat->m8*z + mat->m12;
+    list->vertices[3*i + 1] = mat->m1*x + mat->m5*y + mat->m9*z + mat->m13;
+    list->vertices[3*i + 2] = mat->m2*x + mat->m6*y + mat->m10*z + mat->m14;
+
+    list->texcoords[2*i] = list->texcoordx;
+    list->texcoords[2*i + 1] = list->texcoordy;
+
+    list->normals[3*i] = list->normalx;
+    list->normals[3*i + 1] = list->normaly;
+    list->normals[3*i + 2] = list->normalz;
+
+    list->colors[4*i] = list->colorr;
+    list->colors[4*i + 1] = list->colorg;
+    list->colors[4*i + 2] = list->colorb;
+    list->colors[4*i + 3] = list->colora;
+
+    list->vertexCount++;
+    list->draws[list->drawCounter - 1].vertexCount++;
+}
+
+// Record one vertex (position)
+void rlCmdVertex2f(rlCommandList *list, float x, float y)
+{
+    rlCmdVertex3f(list, x, y, list->currentDepth);
+}
+
+// Set current vertex texture coordinate
+void rlCmdTexCoord2f(rlCommandList *list, float x, float y)
+{
+    list->texcoordx = x;
+    list->texcoordy = y;
+}
+
+// Set current vertex normal
+// NOTE: Normal is transformed by current transform matrix and normalized, as rlNormal3f()
+void rlCmdNormal3f(rlCommandList *list, float x, float y, float z)
+{
+    const rlMatrix *mat = &list->transform;
+    float normalx = mat->m0*x + mat->m4*y + mat->m8*z;
+    float normaly = mat->m1*x + mat->m5*y + mat->m9*z;
+    float normalz = mat->m2*x + mat->m6*y + mat->m10*z;
+
+    float length = sqrtf(normalx*normalx + normaly*normaly + normalz*normalz);
+    if (length != 0.0f)
+    {
+        float ilength = 1.0f/length;
+        normalx *= ilength;
+        normaly *= ilength;
+        normalz *= ilength;
+    }
+
+    list->normalx = normalx;
+    list->normaly = normaly;
+    list->normalz = normalz;
+}
+
+// Set current vertex color
+void rlCmdColor4ub(rlCommandList *list, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    list->colorr = r;
+    list->colorg = g;
+    list->colorb = b;
+    list->colora = a;
+}
+
+// Set current texture for next draws
+// NOTE: Texture id is only recorded, it is bound on submission
+void rlCmdSetTexture(rlCommandList *list, unsigned int id)
+{
+    list->currentTexture = id;
+}
+
+// Push the current transform matrix to command list stack
+void rlCmdPushMatrix(rlCommandList *list)
+{
+    if (list->stackCounter >= RL_MAX_MATRIX_STACK_SIZE)
+    {
+        TRACELOG(RL_LOG_ERROR, "RLGL: Command list matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+        return;
+    }
+
+    list->stack[list->stackCounter] = list->transform;
+    list->stackCounter++;
+}
+
+// Pop latest inserted matrix from command list stack
+void rlCmdPopMatrix(rlCommandList *list)
+{
+    if (list->stackCounter > 0)
+    {
+        list->transform = list->stack[list->stackCounter - 1];
+        list->stackCounter--;
+    }
+}
+
+// Reset current transform matrix to identity matrix
+void rlCmdLoadIdentity(rlCommandList *list)
+{
+    list->transform = rlMatrixIdentity();
+}
+
+// Multiply the current transform matrix by a translation matrix
+void rlCmdTranslatef(rlCommandList *list, float x, float y, float z)
+{
+    rlMatrix matTranslation = {
+        1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    list->transform = rlMatrixMultiply(matTranslation, list->transform);
+}
+
+// Multiply the current transform matrix by a rotation matrix
+// NOTE: The provided angle must be in degrees
+void rlCmdRotatef(rlCommandList *list, float angle, float x, float y, float z)
+{
+    list->transform = rlMatrixMultiply(rlMatrixRotate(angle, x, y, z), list->transform);
+}
+
+// Multiply the current transform matrix by a scaling matrix
+void rlCmdScalef(rlCommandList *list, float x, float y, float z)
+{
+    rlMatrix matScale = {
+        x, 0.0f, 0.0f, 0.0f,
+        0.0f, y, 0.0f, 0.0f,
+        0.0f, 0.0f, z, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    list->transform = rlMatrixMultiply(matScale, list->transform);
+}
+
+// Multiply the current transform matrix by another matrix
+void rlCmdMultMatrixf(rlCommandList *list, const float *matf)
+{
+    rlMatrix mat = { matf[0], matf[4], matf[8], matf[12],
+                   matf[1], matf[5], matf[9], matf[13],
+                   matf[2], matf[6], matf[10], matf[14],
+                   matf[3], matf[7], matf[11], matf[15] };
+
+    list->transform = rlMatrixMultiply(mat, list->transform);
+}
+
+// Submit command lists to current render batch, in array order
+// NOTE: Recorded vertex data is copied into render batch buffer, current shader, blend mode, draw layer
+// and current rlgl transform (if any) are applied as for immediate mode drawing, current texture is kept
+void rlSubmitCommandLists(const rlCommandList *lists, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int currentTextureId = RLGL.State.currentTextureId;
+
+    for (int l = 0; l < count; l++)
+    {
+        const rlCommandList *list = &lists[l];
+        int vertex = 0;
+
+        for (int d = 0; d < list->drawCounter; d++)
+        {
+            const rlDrawCall *draw = &list->draws[d];
+            int primitiveSize = (draw->mode == RL_LINES)? 2 : ((draw->mode == RL_TRIANGLES)? 3 : 4);
+            int copied = 0;
+
+            // Register render batch draw for recorded draw, draws with same state are merged
+            rlSetTexture((draw->textureId != 0)? draw->textureId : RLGL.State.defaultTextureId);
+            rlBegin(draw->mode);
+
+            while (copied < draw->vertexCount)
+            {
+                // Copy as many complete primitives as fit in current buffer, keeping one vertex for security (as rlVertex3f())
+                int available = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - RLGL.State.vertexCounter - 1;
+                int chunk = draw->vertexCount - copied;
+                if (chunk > available) chunk = (available > 0)? (available/primitiveSize)*primitiveSize : 0;
+
+                // Buffer is full, draw batch keeping current draw mode and texture
+                if (chunk == 0)
+                {
+                    rlCheckRenderBatchLimit(primitiveSize + 1);
+                    continue;
+                }
+
+                rlCopyBatchVertices(list, vertex + copied, chunk);
+                copied += chunk;
+            }
+
+            rlEnd();
+
+            vertex += draw->vertexCount;
+        }
+    }
+
+    rlSetTexture(currentTextureId);
+#else
+    // Immediate mode, recorded vertex are provided one by one
+    int currentTextureId = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &currentTextureId);
+    bool textureEnabled = glIsEnabled(GL_TEXTURE_2D);
+
+    for (int l = 0; l < count; l++)
+    {
+        const rlCommandList *list = &lists[l];
+        int vertex = 0;
+
+        for (int d = 0; d < list->drawCounter; d++)
+        {
+            const rlDrawCall *draw = &list->draws[d];
+
+            rlSetTexture((draw->textureId != 0)? draw->textureId : rlGetTextureIdDefault());
+            rlBegin(draw->mode);
+
+                for (int i = vertex; i < (vertex + draw->vertexCount); i++)
+                {
+                    rlTexCoord2f(list->texcoords[2*i], list->texcoords[2*i + 1]);
+                    rlNormal3f(list->normals[3*i], list->normals[3*i + 1], list->normals[3*i + 2]);
+                    rlColor4ub(list->colors[4*i], list->colors[4*i + 1], list->colors[4*i + 2], list->colors[4*i + 3]);
+                    rlVertex3f(list->vertices[3*i], list->vertices[3*i + 1], list->vertices[3*i + 2]);
+                }
+
+            rlEnd();
+
+            vertex += draw->vertexCount;
+        }
+    }
+
+    // Restore texture state previous to submission
+    if (textureEnabled) rlEnableTexture(currentTextureId);
+    else rlDisableTexture();
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3157,7 +4204,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlCacheBindTexture2D(0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3204,7 +4251,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3297,7 +4344,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] rlTexture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3333,7 +4380,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlCacheBindTexture2D(id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3341,7 +4388,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlCacheBindTexture2D(0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3441,7 +4488,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3529,6 +4576,7 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 // Unload texture from GPU memory
 void rlUnloadTexture(unsigned int id)
 {
+    rlCacheDeleteTexture(id);
     glDeleteTextures(1, &id);
 }
 
@@ -3537,7 +4585,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3558,7 +4606,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3570,7 +4618,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture2D(id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3596,7 +4644,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3610,7 +4658,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer();
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture2D(0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3764,7 +4812,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE)
+    {
+        rlCacheDeleteTexture(depthIdU);
+        glDeleteTextures(1, &depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
@@ -3848,6 +4900,16 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #endif
 }
 
+// Orphan dynamic vertex buffer storage, a new storage of same size is allocated by driver
+// NOTE: Draws using previous data keep the old storage, next updates do not wait for them to finish
+void rlOrphanVertexBuffer(unsigned int id, int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+#endif
+}
+
 // Update vertex buffer elements with new data
 // NOTE: dataSize and offset must be provided in bytes
 void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
@@ -4173,6 +5235,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
@@ -4224,6 +5287,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheDeleteProgram(id);
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
@@ -4260,6 +5324,8 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheUniformsModified();
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4309,6 +5375,7 @@ void rlSetUniformMatrix(int locIndex, rlMatrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
+    rlCacheUniformsModified();
     glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
@@ -4317,6 +5384,7 @@ void rlSetUniformMatrix(int locIndex, rlMatrix mat)
 void rlSetUniformMatrices(int locIndex, const rlMatrix *matrices, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheUniformsModified();
     glUniformMatrix4fv(locIndex, count, true, (const float*)matrices);
 #endif
 }
@@ -4325,6 +5393,8 @@ void rlSetUniformMatrices(int locIndex, const rlMatrix *matrices, int count)
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheUniformsModified();
+
     // Check if texture is already active
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
     {
@@ -4355,7 +5425,10 @@ void rlSetShader(unsigned int id, int *locs)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: In deferred draw mode, shader is registered by the draw and enabled on batch drawing
+        if (RLGL.State.deferredDraw) rlDeferredDrawStateChange();
+        else rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
     }
@@ -4792,11 +5865,42 @@ const char *rlGetPixelFormatName(unsigned int format)
     }
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
+// Convert float to half-float (stored as unsigned short)
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+unsigned short rlFloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Convert half-float (stored as unsigned short) to float
+float rlHalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load default shader (just vertex positioning and texture coloring)
 // NOTE: This shader program is used for internal buffers
 // NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlLoadShaderDefault(void)
@@ -4928,174 +6032,1910 @@ static void rlLoadShaderDefault(void)
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
 
-// Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlUnloadShaderDefault(void)
+// Texture slot selection code for multi-texture batch shader (RL_BATCH_TEXTURE_SLOTS = 8)
+// NOTE: Sampler arrays can only be indexed by constant expressions on GLSL 100/120/330
+#define RL_MULTI_TEXTURE_SELECT(texture) \
+    "    vec4 texelColor = " texture "(textures[7], fragTexCoord);                       \n" \
+    "    if (fragTexSlot < 0.5) texelColor = " texture "(textures[0], fragTexCoord);      \n" \
+    "    else if (fragTexSlot < 1.5) texelColor = " texture "(textures[1], fragTexCoord); \n" \
+    "    else if (fragTexSlot < 2.5) texelColor = " texture "(textures[2], fragTexCoord); \n" \
+    "    else if (fragTexSlot < 3.5) texelColor = " texture "(textures[3], fragTexCoord); \n" \
+    "    else if (fragTexSlot < 4.5) texelColor = " texture "(textures[4], fragTexCoord); \n" \
+    "    else if (fragTexSlot < 5.5) texelColor = " texture "(textures[5], fragTexCoord); \n" \
+    "    else if (fragTexSlot < 6.5) texelColor = " texture "(textures[6], fragTexCoord); \n"
+
+// Load multi-texture batch shader (default shader sampling texture slots)
+// NOTE: Loaded: RLGL.State.multiTextureShaderId, RLGL.State.multiTextureShaderLocs
+static void rlLoadShaderMultiTexture(void)
 {
-    glUseProgram(0);
+    RLGL.State.multiTextureShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.multiTextureShaderLocs[i] = -1;
 
-    glDeleteProgram(RLGL.State.defaultShaderId);
+    const char *multiTextureVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#endif
 
-    RL_FREE(RLGL.State.defaultShaderLocs);
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#endif
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
-}
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
 
-#if defined(RLGL_SHOW_GL_DETAILS_INFO)
-// Get compressed format official GL identifier name
-static const char *rlGetCompressedFormatName(int format)
-{
-    switch (format)
+    const char *multiTextureFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+    "uniform sampler2D textures[8];     \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    RL_MULTI_TEXTURE_SELECT("texture2D")
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D textures[8];     \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    RL_MULTI_TEXTURE_SELECT("texture")
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D textures[8];     \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    RL_MULTI_TEXTURE_SELECT("texture")
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+    "uniform sampler2D textures[8];     \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    RL_MULTI_TEXTURE_SELECT("texture2D")
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Vertex texture slot attribute is bound by rlLoadShaderProgram() to RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
+    RLGL.State.multiTextureShaderId = rlLoadShaderCode(multiTextureVShaderCode, multiTextureFShaderCode);
+
+    if (RLGL.State.multiTextureShaderId > 0)
     {
-        // GL_EXT_texture_compression_s3tc
-        case 0x83F0: return "GL_COMPRESSED_RGB_S3TC_DXT1_EXT"; break;
-        case 0x83F1: return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT"; break;
-        case 0x83F2: return "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT"; break;
-        case 0x83F3: return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT"; break;
-        // GL_3DFX_texture_compression_FXT1
-        case 0x86B0: return "GL_COMPRESSED_RGB_FXT1_3DFX"; break;
-        case 0x86B1: return "GL_COMPRESSED_RGBA_FXT1_3DFX"; break;
-        // GL_IMG_texture_compression_pvrtc
-        case 0x8C00: return "GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG"; break;
-        case 0x8C01: return "GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG"; break;
-        case 0x8C02: return "GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG"; break;
-        case 0x8C03: return "GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG"; break;
-        // GL_OES_compressed_ETC1_RGB8_texture
-        case 0x8D64: return "GL_ETC1_RGB8_OES"; break;
-        // GL_ARB_texture_compression_rgtc
-        case 0x8DBB: return "GL_COMPRESSED_RED_RGTC1"; break;
-        case 0x8DBC: return "GL_COMPRESSED_SIGNED_RED_RGTC1"; break;
-        case 0x8DBD: return "GL_COMPRESSED_RG_RGTC2"; break;
-        case 0x8DBE: return "GL_COMPRESSED_SIGNED_RG_RGTC2"; break;
-        // GL_ARB_texture_compression_bptc
-        case 0x8E8C: return "GL_COMPRESSED_RGBA_BPTC_UNORM_ARB"; break;
-        case 0x8E8D: return "GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB"; break;
-        case 0x8E8E: return "GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT_ARB"; break;
-        case 0x8E8F: return "GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB"; break;
-        // GL_ARB_ES3_compatibility
-        case 0x9274: return "GL_COMPRESSED_RGB8_ETC2"; break;
-        case 0x9275: return "GL_COMPRESSED_SRGB8_ETC2"; break;
-        case 0x9276: return "GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2"; break;
-        case 0x9277: return "GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2"; break;
-        case 0x9278: return "GL_COMPRESSED_RGBA8_ETC2_EAC"; break;
-        case 0x9279: return "GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC"; break;
-        case 0x9270: return "GL_COMPRESSED_R11_EAC"; break;
-        case 0x9271: return "GL_COMPRESSED_SIGNED_R11_EAC"; break;
-        case 0x9272: return "GL_COMPRESSED_RG11_EAC"; break;
-        case 0x9273: return "GL_COMPRESSED_SIGNED_RG11_EAC"; break;
-        // GL_KHR_texture_compression_astc_hdr
-        case 0x93B0: return "GL_COMPRESSED_RGBA_ASTC_4x4_KHR"; break;
-        case 0x93B1: return "GL_COMPRESSED_RGBA_ASTC_5x4_KHR"; break;
-        case 0x93B2: return "GL_COMPRESSED_RGBA_ASTC_5x5_KHR"; break;
-        case 0x93B3: return "GL_COMPRESSED_RGBA_ASTC_6x5_KHR"; break;
-        case 0x93B4: return "GL_COMPRESSED_RGBA_ASTC_6x6_KHR"; break;
-        case 0x93B5: return "GL_COMPRESSED_RGBA_ASTC_8x5_KHR"; break;
-        case 0x93B6: return "GL_COMPRESSED_RGBA_ASTC_8x6_KHR"; break;
-        case 0x93B7: return "GL_COMPRESSED_RGBA_ASTC_8x8_KHR"; break;
-        case 0x93B8: return "GL_COMPRESSED_RGBA_ASTC_10x5_KHR"; break;
-        case 0x93B9: return "GL_COMPRESSED_RGBA_ASTC_10x6_KHR"; break;
-        case 0x93BA: return "GL_COMPRESSED_RGBA_ASTC_10x8_KHR"; break;
-        case 0x93BB: return "GL_COMPRESSED_RGBA_ASTC_10x10_KHR"; break;
-        case 0x93BC: return "GL_COMPRESSED_RGBA_ASTC_12x10_KHR"; break;
-        case 0x93BD: return "GL_COMPRESSED_RGBA_ASTC_12x12_KHR"; break;
-        case 0x93D0: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR"; break;
-        case 0x93D1: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR"; break;
-        case 0x93D2: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR"; break;
-        case 0x93D3: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR"; break;
-        case 0x93D4: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR"; break;
-        case 0x93D5: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR"; break;
-        case 0x93D6: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR"; break;
-        case 0x93D7: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR"; break;
-        case 0x93D8: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR"; break;
-        case 0x93D9: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR"; break;
-        case 0x93DA: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR"; break;
-        case 0x93DB: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR"; break;
-        case 0x93DC: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR"; break;
-        case 0x93DD: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR"; break;
-        default: return "GL_COMPRESSED_UNKNOWN"; break;
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Multi-texture batch shader loaded successfully", RLGL.State.multiTextureShaderId);
+
+        // Set multi-texture shader locations: attributes locations
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+
+        // Set multi-texture shader locations: uniform locations
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+        RLGL.State.multiTextureShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.multiTextureShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+
+        // Texture slots samplers are set once, first slot reads texture unit 0 (texture0) and next slots
+        // read texture units after the additional sampler textures ones (rlSetShaderValueTexture())
+        // NOTE: Available slots are limited by texture units, unused slots samplers read texture unit 0
+        int maxUnits = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxUnits);
+
+        RLGL.State.multiTextureSlots = maxUnits - RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS;
+        if (RLGL.State.multiTextureSlots > RL_BATCH_TEXTURE_SLOTS) RLGL.State.multiTextureSlots = RL_BATCH_TEXTURE_SLOTS;
+        if (RLGL.State.multiTextureSlots < 1) RLGL.State.multiTextureSlots = 1;
+
+        int units[RL_BATCH_TEXTURE_SLOTS] = { 0 };
+        for (int i = 1; i < RLGL.State.multiTextureSlots; i++) units[i] = RL_BATCH_TEXTURE_SLOT_UNIT(i);
+
+        rlCacheUseProgram(RLGL.State.multiTextureShaderId);
+        glUniform1iv(glGetUniformLocation(RLGL.State.multiTextureShaderId, "textures"), RL_BATCH_TEXTURE_SLOTS, units);
+        rlCacheUseProgram(0);
     }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load multi-texture batch shader", RLGL.State.multiTextureShaderId);
 }
-#endif  // RLGL_SHOW_GL_DETAILS_INFO
-
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
-// Get pixel data size in bytes (image or texture)
-// NOTE: Size depends on pixel format
-static int rlGetPixelDataSize(int width, int height, int format)
+// Assign texture to a texture slot of current multi-texture batch
+// NOTE: If all texture slots are in use, batch is drawn to release them
+static void rlSetBatchTextureSlot(unsigned int id)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    rlRenderBatch *batch = RLGL.currentBatch;
+    int slot = -1;
 
-    switch (format)
+    for (int i = 0; i < batch->textureSlotCount; i++)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        if (batch->textureSlots[i] == id)
+        {
+            slot = i;
+            break;
+        }
     }
 
-    double bytesPerPixel = (double)bpp/8.0;
-    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
-
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    if (slot == -1)
     {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        if (batch->textureSlotCount >= RLGL.State.multiTextureSlots) rlDrawRenderBatch(batch);
+
+        slot = batch->textureSlotCount;
+        batch->textureSlots[slot] = id;
+        batch->textureSlotCount++;
     }
 
-    return dataSize;
+    batch->currentTextureSlot = slot;
 }
 
-// Auxiliar math functions
-
-// Get float array of matrix data
-static rl_float16 rlMatrixToFloatV(rlMatrix mat)
+// Copy command list vertex data into current render batch buffer
+// NOTE: Vertex count must fit in current buffer, current draw is registered on first vertex (as rlVertex3f())
+static void rlCopyBatchVertices(const rlCommandList *list, int first, int count)
 {
-    rl_float16 result = { 0 };
+    rlRenderBatch *batch = RLGL.currentBatch;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    rlDrawCall *draw = &batch->draws[batch->drawCounter - 1];
+    const rlMatrix *mat = &RLGL.State.transform;
 
-    result.v[0] = mat.m0;
-    result.v[1] = mat.m1;
-    result.v[2] = mat.m2;
-    result.v[3] = mat.m3;
-    result.v[4] = mat.m4;
-    result.v[5] = mat.m5;
-    result.v[6] = mat.m6;
-    result.v[7] = mat.m7;
-    result.v[8] = mat.m8;
-    result.v[9] = mat.m9;
-    result.v[10] = mat.m10;
-    result.v[11] = mat.m11;
-    result.v[12] = mat.m12;
-    result.v[13] = mat.m13;
-    result.v[14] = mat.m14;
+    if (draw->vertexCount == 0)
+    {
+        draw->shaderId = RLGL.State.currentShaderId;
+        draw->shaderLocs = RLGL.State.currentShaderLocs;
+        draw->blendMode = RLGL.State.currentBlendMode;
+        draw->layer = RLGL.State.drawLayer;
+        draw->depth = RLGL.State.drawDepth;
+    }
+
+    if (batch->flags & RL_BATCH_INTERLEAVED)
+    {
+        // NOTE: Interleaved layout depends on batch flags, attributes are copied by vertex (as rlVertex3f())
+        for (int i = first; i < (first + count); i++)
+        {
+            unsigned char *vertex = buffer->interleaved + (RLGL.State.vertexCounter + i - first)*buffer->vertexStride;
+
+            float position[3] = { list->vertices[3*i], list->vertices[3*i + 1], list->vertices[3*i + 2] };
+            if (RLGL.State.transformRequired)
+            {
+                position[0] = mat->m0*list->vertices[3*i] + mat->m4*list->vertices[3*i + 1] + mat->m8*list->vertices[3*i + 2] + mat->m12;
+                position[1] = mat->m1*list->vertices[3*i] + mat->m5*list->vertices[3*i + 1] + mat->m9*list->vertices[3*i + 2] + mat->m13;
+                position[2] = mat->m2*list->vertices[3*i] + mat->m6*list->vertices[3*i + 1] + mat->m10*list->vertices[3*i + 2] + mat->m14;
+            }
+            memcpy(vertex, position, sizeof(position));
+            vertex += sizeof(position);
+
+            if (batch->flags & RL_BATCH_TEXCOORDS_HALF)
+            {
+                unsigned short texcoord[2] = { rlFloatToHalf(list->texcoords[2*i]), rlFloatToHalf(list->texcoords[2*i + 1]) };
+                memcpy(vertex, texcoord, sizeof(texcoord));
+                vertex += sizeof(texcoord);
+            }
+            else
+            {
+                memcpy(vertex, &list->texcoords[2*i], 2*sizeof(float));
+                vertex += 2*sizeof(float);
+            }
+
+            if (!(batch->flags & RL_BATCH_NO_NORMALS))
+            {
+                float normal[3] = { list->normals[3*i], list->normals[3*i + 1], list->normals[3*i + 2] };
+                if (RLGL.State.transformRequired) rlTransformBatchNormal(normal);
+                memcpy(vertex, normal, sizeof(normal));
+                vertex += sizeof(normal);
+            }
+
+            memcpy(vertex, &list->colors[4*i], 4*sizeof(unsigned char));
+
+            // Add current texture slot (padded to 4 bytes)
+            if (batch->flags & RL_BATCH_MULTI_TEXTURE) vertex[4] = (unsigned char)batch->currentTextureSlot;
+        }
+    }
+    else
+    {
+        memcpy(buffer->vertices + 3*RLGL.State.vertexCounter, list->vertices + 3*first, 3*count*sizeof(float));
+        memcpy(buffer->texcoords + 2*RLGL.State.vertexCounter, list->texcoords + 2*first, 2*count*sizeof(float));
+        memcpy(buffer->normals + 3*RLGL.State.vertexCounter, list->normals + 3*first, 3*count*sizeof(float));
+        memcpy(buffer->colors + 4*RLGL.State.vertexCounter, list->colors + 4*first, 4*count*sizeof(unsigned char));
+
+        if (RLGL.State.transformRequired)
+        {
+            for (int i = RLGL.State.vertexCounter; i < (RLGL.State.vertexCounter + count); i++)
+            {
+                float x = buffer->vertices[3*i];
+                float y = buffer->vertices[3*i + 1];
+                float z = buffer->vertices[3*i + 2];
+
+                buffer->vertices[3*i] = mat->m0*x + mat->m4*y + mat->m8*z + mat->m12;
+                buffer->vertices[3*i + 1] = mat->m1*x + mat->m5*y + mat->m9*z + mat->m13;
+                buffer->vertices[3*i + 2] = mat->m2*x + mat->m6*y + mat->m10*z + mat->m14;
+
+                rlTransformBatchNormal(&buffer->normals[3*i]);
+            }
+        }
+    }
+
+    RLGL.State.vertexCounter += count;
+    draw->vertexCount += count;
+}
+
+// Transform normal by current rlgl transform and normalize it (as rlNormal3f())
+static void rlTransformBatchNormal(float *normal)
+{
+    const rlMatrix *mat = &RLGL.State.transform;
+    float x = mat->m0*normal[0] + mat->m4*normal[1] + mat->m8*normal[2];
+    float y = mat->m1*normal[0] + mat->m5*normal[1] + mat->m9*normal[2];
+    float z = mat->m2*normal[0] + mat->m6*normal[1] + mat->m10*normal[2];
+
+    float length = sqrtf(x*x + y*y + z*z);
+    if (length != 0.0f)
+    {
+        float ilength = 1.0f/length;
+        x *= ilength;
+        y *= ilength;
+        z *= ilength;
+    }
+
+    normal[0] = x;
+    normal[1] = y;
+    normal[2] = z;
+}
+
+// Load instanced sprites batch: shader, quad corners and instances buffers
+// NOTE: Every sprite instance is expanded into a quad (two triangles) by the vertex shader,
+// corner position, rotation and texture coordinates are computed on GPU
+static void rlLoadSpriteBatch(void)
+{
+    const char *spriteVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 spriteCorner;       \n"
+    "attribute vec4 spriteDest;         \n"
+    "attribute vec4 spriteSource;       \n"
+    "attribute vec4 spriteTransform;    \n"
+    "attribute vec4 spriteColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 spriteCorner;              \n"
+    "in vec4 spriteDest;                \n"
+    "in vec4 spriteSource;              \n"
+    "in vec4 spriteTransform;           \n"
+    "in vec4 spriteColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec2 spriteCorner;              \n"
+    "in vec4 spriteDest;                \n"
+    "in vec4 spriteSource;              \n"
+    "in vec4 spriteTransform;           \n"
+    "in vec4 spriteColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "attribute vec2 spriteCorner;       \n"
+    "attribute vec4 spriteDest;         \n"
+    "attribute vec4 spriteSource;       \n"
+    "attribute vec4 spriteTransform;    \n"
+    "attribute vec4 spriteColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 local = spriteCorner*spriteDest.zw - spriteTransform.xy; \n"
+    "    float s = sin(radians(spriteTransform.z)); \n"
+    "    float c = cos(radians(spriteTransform.z)); \n"
+    "    vec2 position = spriteDest.xy + vec2(local.x*c - local.y*s, local.x*s + local.y*c); \n"
+    "    fragTexCoord = mix(spriteSource.xy, spriteSource.zw, spriteCorner); \n"
+    "    fragColor = spriteColor;       \n"
+    "    gl_Position = mvp*vec4(position, spriteTransform.w, 1.0); \n"
+    "}                                  \n";
+
+    const char *spriteFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    RLGL.Sprites.shaderId = rlLoadShaderCode(spriteVShaderCode, spriteFShaderCode);
+
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        const char *attribNames[5] = { "spriteCorner", "spriteDest", "spriteSource", "spriteTransform", "spriteColor" };
+        for (int i = 0; i < 5; i++)
+        {
+            RLGL.Sprites.attribLocs[i] = glGetAttribLocation(RLGL.Sprites.shaderId, attribNames[i]);
+            if (RLGL.Sprites.attribLocs[i] == -1) RLGL.Sprites.failed = true;
+        }
+
+        // NOTE: All locations must be reseted to -1 (no location)
+        RLGL.Sprites.shaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.Sprites.shaderLocs[i] = -1;
+
+        RLGL.Sprites.shaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+        RLGL.Sprites.shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+        RLGL.Sprites.shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.Sprites.shaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Quad corners, two triangles: top-left, bottom-left, bottom-right, top-left, bottom-right, top-right
+        float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &RLGL.Sprites.vaoId);
+            glBindVertexArray(RLGL.Sprites.vaoId);
+        }
+
+        glGenBuffers(2, RLGL.Sprites.vboId);
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, RL_SPRITE_BATCH_INSTANCES*sizeof(rlSpriteInstance), NULL, GL_DYNAMIC_DRAW);
+
+        // Vertex attributes are stored by VAO if available, otherwise set on every draw
+        if (RLGL.ExtSupported.vao)
+        {
+            rlSetSpriteBatchVertexAttribs();
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        RLGL.Sprites.instances = (rlSpriteInstance *)RL_MALLOC(RL_SPRITE_BATCH_INSTANCES*sizeof(rlSpriteInstance));
+        RLGL.Sprites.instanceCount = 0;
+
+        if (!RLGL.Sprites.failed) TRACELOG(RL_LOG_INFO, "RLGL: Sprite batch loaded successfully (%i instances per draw)", RL_SPRITE_BATCH_INSTANCES);
+        else TRACELOG(RL_LOG_WARNING, "RLGL: Sprite batch shader attributes not found, sprites drawn in immediate mode");
+    }
+    else
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to load sprite batch, sprites drawn in immediate mode");
+        RLGL.Sprites.failed = true;
+    }
+}
+
+// Unload instanced sprites batch
+static void rlUnloadSpriteBatch(void)
+{
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &RLGL.Sprites.vaoId);
+        glDeleteBuffers(2, RLGL.Sprites.vboId);
+
+        rlCacheDeleteProgram(RLGL.Sprites.shaderId);
+        glDeleteProgram(RLGL.Sprites.shaderId);
+
+        RL_FREE(RLGL.Sprites.shaderLocs);
+        RL_FREE(RLGL.Sprites.instances);
+        RLGL.Sprites.instances = NULL;
+        RLGL.Sprites.instanceCount = 0;
+        RLGL.Sprites.shaderId = 0;
+    }
+}
+
+// Set instanced sprites batch vertex attributes
+// NOTE: Quad corners advance per vertex, sprite instance data advance per instance (divisor = 1)
+static void rlSetSpriteBatchVertexAttribs(void)
+{
+    int *locs = RLGL.Sprites.attribLocs;
+    int stride = sizeof(rlSpriteInstance);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+    glVertexAttribPointer(locs[0], 2, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(locs[0]);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+    glVertexAttribPointer(locs[1], 4, GL_FLOAT, 0, stride, (void *)0);                        // Destination rectangle
+    glVertexAttribPointer(locs[2], 4, GL_FLOAT, 0, stride, (void *)(4*sizeof(float)));        // Source texture coordinates
+    glVertexAttribPointer(locs[3], 4, GL_FLOAT, 0, stride, (void *)(8*sizeof(float)));        // Origin, rotation and depth
+    glVertexAttribPointer(locs[4], 4, GL_UNSIGNED_BYTE, 1, stride, (void *)(12*sizeof(float))); // Tint color
+
+    for (int i = 1; i < 5; i++)
+    {
+        glEnableVertexAttribArray(locs[i]);
+        glVertexAttribDivisor(locs[i], 1);
+    }
+}
+
+// Draw instanced sprites batch, one instanced draw call for all sprites
+static void rlDrawSpriteBatch(void)
+{
+    int count = RLGL.Sprites.instanceCount;
+    if (count == 0) return;
+
+    if (rlProfileScope != NULL) rlProfileScope("rlDrawSpriteBatch", true);
+
+    rlUpdateBatchVertexBuffer(RLGL.Sprites.vboId[1], RLGL.Sprites.instances, count*sizeof(rlSpriteInstance), RL_SPRITE_BATCH_INSTANCES*sizeof(rlSpriteInstance), true);
+
+    rlEnableBatchShader(RLGL.Sprites.shaderId, RLGL.Sprites.shaderLocs);
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.Sprites.vaoId);
+    else rlSetSpriteBatchVertexAttribs();
+
+    rlCacheActiveTexture(0);
+    rlCacheBindTexture2D(RLGL.Sprites.textureId);
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    else
+    {
+        // Reset instanced attributes, attribute locations could be used by other shaders
+        for (int i = 0; i < 5; i++)
+        {
+            if (i > 0) glVertexAttribDivisor(RLGL.Sprites.attribLocs[i], 0);
+            glDisableVertexAttribArray(RLGL.Sprites.attribLocs[i]);
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Reset instances counter for next sprites
+    RLGL.Sprites.instanceCount = 0;
+
+    if (rlProfileScope != NULL) rlProfileScope("rlDrawSpriteBatch", false);
+}
+
+// Unload default shader
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlUnloadShaderDefault(void)
+{
+    rlCacheUseProgram(0);
+
+    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+    glDeleteShader(RLGL.State.defaultVShaderId);
+    glDeleteShader(RLGL.State.defaultFShaderId);
+
+    rlCacheDeleteProgram(RLGL.State.defaultShaderId);
+    glDeleteProgram(RLGL.State.defaultShaderId);
+
+    RL_FREE(RLGL.State.defaultShaderLocs);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+}
+
+#if defined(RLGL_SHOW_GL_DETAILS_INFO)
+// Get compressed format official GL identifier name
+static const char *rlGetCompressedFormatName(int format)
+{
+    switch (format)
+    {
+        // GL_EXT_texture_compression_s3tc
+        case 0x83F0: return "GL_COMPRESSED_RGB_S3TC_DXT1_EXT"; break;
+        case 0x83F1: return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT"; break;
+        case 0x83F2: return "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT"; break;
+        case 0x83F3: return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT"; break;
+        // GL_3DFX_texture_compression_FXT1
+        case 0x86B0: return "GL_COMPRESSED_RGB_FXT1_3DFX"; break;
+        case 0x86B1: return "GL_COMPRESSED_RGBA_FXT1_3DFX"; break;
+        // GL_IMG_texture_compression_pvrtc
+        case 0x8C00: return "GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG"; break;
+        case 0x8C01: return "GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG"; break;
+        case 0x8C02: return "GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG"; break;
+        case 0x8C03: return "GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG"; break;
+        // GL_OES_compressed_ETC1_RGB8_texture
+        case 0x8D64: return "GL_ETC1_RGB8_OES"; break;
+        // GL_ARB_texture_compression_rgtc
+        case 0x8DBB: return "GL_COMPRESSED_RED_RGTC1"; break;
+        case 0x8DBC: return "GL_COMPRESSED_SIGNED_RED_RGTC1"; break;
+        case 0x8DBD: return "GL_COMPRESSED_RG_RGTC2"; break;
+        case 0x8DBE: return "GL_COMPRESSED_SIGNED_RG_RGTC2"; break;
+        // GL_ARB_texture_compression_bptc
+        case 0x8E8C: return "GL_COMPRESSED_RGBA_BPTC_UNORM_ARB"; break;
+        case 0x8E8D: return "GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB"; break;
+        case 0x8E8E: return "GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT_ARB"; break;
+        case 0x8E8F: return "GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB"; break;
+        // GL_ARB_ES3_compatibility
+        case 0x9274: return "GL_COMPRESSED_RGB8_ETC2"; break;
+        case 0x9275: return "GL_COMPRESSED_SRGB8_ETC2"; break;
+        case 0x9276: return "GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2"; break;
+        case 0x9277: return "GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2"; break;
+        case 0x9278: return "GL_COMPRESSED_RGBA8_ETC2_EAC"; break;
+        case 0x9279: return "GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC"; break;
+        case 0x9270: return "GL_COMPRESSED_R11_EAC"; break;
+        case 0x9271: return "GL_COMPRESSED_SIGNED_R11_EAC"; break;
+        case 0x9272: return "GL_COMPRESSED_RG11_EAC"; break;
+        case 0x9273: return "GL_COMPRESSED_SIGNED_RG11_EAC"; break;
+        // GL_KHR_texture_compression_astc_hdr
+        case 0x93B0: return "GL_COMPRESSED_RGBA_ASTC_4x4_KHR"; break;
+        case 0x93B1: return "GL_COMPRESSED_RGBA_ASTC_5x4_KHR"; break;
+        case 0x93B2: return "GL_COMPRESSED_RGBA_ASTC_5x5_KHR"; break;
+        case 0x93B3: return "GL_COMPRESSED_RGBA_ASTC_6x5_KHR"; break;
+        case 0x93B4: return "GL_COMPRESSED_RGBA_ASTC_6x6_KHR"; break;
+        case 0x93B5: return "GL_COMPRESSED_RGBA_ASTC_8x5_KHR"; break;
+        case 0x93B6: return "GL_COMPRESSED_RGBA_ASTC_8x6_KHR"; break;
+        case 0x93B7: return "GL_COMPRESSED_RGBA_ASTC_8x8_KHR"; break;
+        case 0x93B8: return "GL_COMPRESSED_RGBA_ASTC_10x5_KHR"; break;
+        case 0x93B9: return "GL_COMPRESSED_RGBA_ASTC_10x6_KHR"; break;
+        case 0x93BA: return "GL_COMPRESSED_RGBA_ASTC_10x8_KHR"; break;
+        case 0x93BB: return "GL_COMPRESSED_RGBA_ASTC_10x10_KHR"; break;
+        case 0x93BC: return "GL_COMPRESSED_RGBA_ASTC_12x10_KHR"; break;
+        case 0x93BD: return "GL_COMPRESSED_RGBA_ASTC_12x12_KHR"; break;
+        case 0x93D0: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR"; break;
+        case 0x93D1: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR"; break;
+        case 0x93D2: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR"; break;
+        case 0x93D3: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR"; break;
+        case 0x93D4: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR"; break;
+        case 0x93D5: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR"; break;
+        case 0x93D6: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR"; break;
+        case 0x93D7: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR"; break;
+        case 0x93D8: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR"; break;
+        case 0x93D9: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR"; break;
+        case 0x93DA: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR"; break;
+        case 0x93DB: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR"; break;
+        case 0x93DC: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR"; break;
+        case 0x93DD: return "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR"; break;
+        default: return "GL_COMPRESSED_UNKNOWN"; break;
+    }
+}
+#endif  // RLGL_SHOW_GL_DETAILS_INFO
+
+// Load render batch vertex buffer into GPU, returns the vertex array to be written by CPU
+// NOTE: For RL_BATCH_PERSISTENT_MAPPED, returned array is the GPU buffer persistently mapped
+static void *rlLoadBatchVertexBuffer(unsigned int *id, int size, void *data, unsigned int flags)
+{
+    void *array = data;
+
+    glGenBuffers(1, id);
+    glBindBuffer(GL_ARRAY_BUFFER, *id);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (flags & RL_BATCH_PERSISTENT_MAPPED)
+    {
+        // NOTE: Coherent mapping makes CPU writes visible to following GL commands without explicit flushes
+        GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glBufferStorage(GL_ARRAY_BUFFER, size, NULL, mapFlags);
+        array = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, mapFlags);
+
+        if (array != NULL) memset(array, 0, size);
+        else TRACELOG(RL_LOG_ERROR, "RLGL: [VBO ID %i] Failed to map render batch vertex buffer", *id);
+
+        return array;
+    }
+#endif
+
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+
+    return array;
+}
+
+// Update render batch vertex buffer with CPU vertex data
+// NOTE: Buffer storage is orphaned first if required, to avoid a sync point with GPU
+static void rlUpdateBatchVertexBuffer(unsigned int id, const void *data, int dataSize, int bufferSize, bool orphan)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    if (orphan) glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+}
+
+// Set render batch vertex attributes for current shader locations
+// NOTE: Vertex array pointers are stored by VAO if available, otherwise they must be set before every draw
+static void rlSetBatchVertexAttribs(const rlVertexBuffer *buffer, unsigned int flags)
+{
+    int *locs = RLGL.State.currentShaderLocs;
+
+    if (flags & RL_BATCH_INTERLEAVED)
+    {
+        int stride = buffer->vertexStride;
+        size_t offset = 0;
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+
+        // Vertex position (shader-location = 0)
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, stride, (void *)offset);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+        offset += 3*sizeof(float);
+
+        // Vertex texcoord (shader-location = 1)
+#if defined(GL_HALF_FLOAT) && !defined(GRAPHICS_API_OPENGL_21) && (!defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3))
+        if (flags & RL_BATCH_TEXCOORDS_HALF)
+        {
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_HALF_FLOAT, 0, stride, (void *)offset);
+            offset += 2*sizeof(unsigned short);
+        }
+        else
+#endif
+        {
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, stride, (void *)offset);
+            offset += 2*sizeof(float);
+        }
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        // Vertex normal (shader-location = 2)
+        if (!(flags & RL_BATCH_NO_NORMALS))
+        {
+            if (locs[RL_SHADER_LOC_VERTEX_NORMAL] != -1)
+            {
+                glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, stride, (void *)offset);
+                glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            }
+            offset += 3*sizeof(float);
+        }
+
+        // Vertex color (shader-location = 3)
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *)offset);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+        offset += 4*sizeof(unsigned char);
+
+        // Vertex texture slot (shader-location = 6), only read by multi-texture batch shader
+        if (flags & RL_BATCH_MULTI_TEXTURE)
+        {
+            glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride, (void *)offset);
+            glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        }
+    }
+    else
+    {
+        // Vertex position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        // Vertex texcoord (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        // Vertex normal (shader-location = 2)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+
+        // Vertex color (shader-location = 3)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[3]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+}
+
+// Register a new draw for the next vertex, required by a state change in deferred draw mode
+// NOTE: Current draw mode and texture are kept, state is registered on first vertex
+static void rlDeferredDrawStateChange(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        // Make sure current draw vertexCount is aligned a multiple of 4 (check rlSetTexture())
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+    }
+}
+
+// Compare draws state for deferred draw sorting: layer, shader, blend mode, texture, depth, mode
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b)
+{
+    if (a->layer != b->layer) return (a->layer < b->layer)? -1 : 1;
+    if (a->shaderId != b->shaderId) return (a->shaderId < b->shaderId)? -1 : 1;
+    if (a->blendMode != b->blendMode) return (a->blendMode < b->blendMode)? -1 : 1;
+    if (a->textureId != b->textureId) return (a->textureId < b->textureId)? -1 : 1;
+    if (a->depth != b->depth) return (a->depth > b->depth)? -1 : 1;
+    if (a->mode != b->mode) return (a->mode < b->mode)? -1 : 1;
+
+    return 0;
+}
+
+// Sort render batch draws by state and merge the ones sharing the same state
+// NOTE: Sorting is stable, so submission order is kept for draws with same state.
+// Vertex data is reordered to get a contiguous vertex range for every merged draw, batch
+// is left untouched if reordered vertex data does not fit in the vertex buffer
+static void rlSortRenderBatchDraws(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };      // Sorted draws indices
+    int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // Draws vertex offset in current vertex data
+    int targets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // Sorted draws vertex offset in reordered vertex data
+    rlDrawCall merged[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int count = 0;
+    int mergedCount = 0;
+    bool sorted = true;
+
+    // Stable insertion sort of the non-empty draws, draws count is small
+    for (int i = 0, offset = 0; i < batch->drawCounter; i++)
+    {
+        offsets[i] = offset;
+        offset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+        if (batch->draws[i].vertexCount == 0) continue;
+
+        // Multi-texture draws sample texture slots, texture is not part of the draw state
+        if ((batch->flags & RL_BATCH_MULTI_TEXTURE) && (batch->draws[i].shaderId == RLGL.State.defaultShaderId)) batch->draws[i].textureId = 0;
+
+        int j = count;
+        while ((j > 0) && (rlCompareDrawCalls(&batch->draws[order[j - 1]], &batch->draws[i]) > 0))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+
+        if (j != count) sorted = false;
+        order[j] = i;
+        count++;
+    }
+
+    // Merge sorted draws sharing state, vertex data is packed and aligned to 4 vertex between merged draws
+    int vertexCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[order[i]];
+
+        if ((mergedCount == 0) || (rlCompareDrawCalls(&merged[mergedCount - 1], draw) != 0))
+        {
+            if (mergedCount > 0)
+            {
+                rlDrawCall *last = &merged[mergedCount - 1];
+                last->vertexAlignment = (last->mode == RL_QUADS)? 0 : (4 - last->vertexCount%4)%4;
+                vertexCount += last->vertexAlignment;
+            }
+
+            merged[mergedCount] = *draw;
+            merged[mergedCount].vertexCount = 0;
+            merged[mergedCount].vertexAlignment = 0;
+            mergedCount++;
+        }
+
+        targets[i] = vertexCount;
+        merged[mergedCount - 1].vertexCount += draw->vertexCount;
+        vertexCount += draw->vertexCount;
+    }
+
+    // Nothing to reorder if draws were already in order and none of them merged
+    if (sorted && (mergedCount == count)) return;
+    if (vertexCount > buffer->elementCount*4) return;
+
+    // Reorder vertex data arrays, using scratch memory
+    unsigned char *arrays[4] = { 0 };
+    int sizes[4] = { 0 };
+    int arrayCount = 0;
+
+    if (batch->flags & RL_BATCH_INTERLEAVED)
+    {
+        arrays[0] = buffer->interleaved; sizes[0] = buffer->vertexStride;
+        arrayCount = 1;
+    }
+    else
+    {
+        arrays[0] = (unsigned char *)buffer->vertices; sizes[0] = 3*sizeof(float);
+        arrays[1] = (unsigned char *)buffer->texcoords; sizes[1] = 2*sizeof(float);
+        arrays[2] = (unsigned char *)buffer->normals; sizes[2] = 3*sizeof(float);
+        arrays[3] = buffer->colors; sizes[3] = 4*sizeof(unsigned char);
+        arrayCount = 4;
+    }
+
+    for (int a = 0; a < arrayCount; a++)
+    {
+        int requiredSize = vertexCount*sizes[a];
+
+        if (RLGL.State.deferredDataSize < requiredSize)
+        {
+            unsigned char *data = (unsigned char *)RL_REALLOC(RLGL.State.deferredData, requiredSize);
+            if (data == NULL) return;
+
+            RLGL.State.deferredData = data;
+            RLGL.State.deferredDataSize = requiredSize;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            memcpy(RLGL.State.deferredData + targets[i]*sizes[a], arrays[a] + offsets[order[i]]*sizes[a], batch->draws[order[i]].vertexCount*sizes[a]);
+        }
+
+        memcpy(arrays[a], RLGL.State.deferredData, requiredSize);
+    }
+
+    // Replace batch draws by merged draws
+    for (int i = 0; i < mergedCount; i++) batch->draws[i] = merged[i];
+    batch->drawCounter = mergedCount;
+    RLGL.State.vertexCounter = vertexCount;
+}
+
+// Enable shader for batch drawing and upload current matrices and default values
+// NOTE: Uniforms already uploaded to shader on previous batch drawing are skipped (GL state cache)
+static void rlEnableBatchShader(unsigned int id, int *locs)
+{
+    // Set current shader
+    rlCacheUseProgram(id);
+
+    // Find shader batch uniforms cache entry, a new entry requires all uniforms upload
+    rlShaderUniformCache *cache = NULL;
+    bool force = false;
+
+    for (int i = 0; i < RL_STATE_CACHE_SHADERS; i++)
+    {
+        if ((RLGL.Cache.shaders[i].id == id) && (memcmp(RLGL.Cache.shaders[i].locs, locs, sizeof(RLGL.Cache.shaders[i].locs)) == 0))
+        {
+            cache = &RLGL.Cache.shaders[i];
+            break;
+        }
+    }
+
+    if (cache == NULL)
+    {
+        cache = &RLGL.Cache.shaders[RLGL.Cache.nextShader];
+        RLGL.Cache.nextShader = (RLGL.Cache.nextShader + 1)%RL_STATE_CACHE_SHADERS;
+
+        cache->id = id;
+        memcpy(cache->locs, locs, sizeof(cache->locs));
+        force = true;
+    }
+
+    // Create modelview-projection matrix and upload to shader
+    rlMatrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    rlCacheUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], &cache->mvp, matMVP, force);
+
+    if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+    {
+        rlCacheUniformMatrix(locs[RL_SHADER_LOC_MATRIX_PROJECTION], &cache->projection, RLGL.State.projection, force);
+    }
+
+    // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
+    // transformations and rendering occur between rlPushMatrix and rlPopMatrix.
+
+    if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+    {
+        rlCacheUniformMatrix(locs[RL_SHADER_LOC_MATRIX_VIEW], &cache->view, RLGL.State.modelview, force);
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        rlCacheUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MODEL], &cache->model, RLGL.State.transform, force);
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
+    {
+        // NOTE: Normal matrix only computed if transform matrix changed
+        if (force || (memcmp(&cache->transform, &RLGL.State.transform, sizeof(rlMatrix)) != 0))
+        {
+            glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+            cache->transform = RLGL.State.transform;
+            RLGL.Cache.callsIssued++;
+        }
+        else RLGL.Cache.callsSkipped++;
+    }
+
+    // Setup some default shader values
+    // NOTE: Only uploaded once, cache entry is invalidated if shader uniforms are modified
+    if (force)
+    {
+        glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+        glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+        RLGL.Cache.callsIssued += 2;
+    }
+    else RLGL.Cache.callsSkipped += 2;
+}
+
+// Apply blend mode to OpenGL blending state
+// NOTE: Custom blend modes use current factors and equations set with rlSetBlendFactors*()
+static void rlApplyBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: rlCacheBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: rlCacheBlendFunc(GL_SRC_ALPHA, GL_ONE, GL_SRC_ALPHA, GL_ONE); rlCacheBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: rlCacheBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: rlCacheBlendFunc(GL_ONE, GL_ONE, GL_ONE, GL_ONE); rlCacheBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: rlCacheBlendFunc(GL_ONE, GL_ONE, GL_ONE, GL_ONE); rlCacheBlendEquation(GL_FUNC_SUBTRACT, GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: rlCacheBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            rlCacheBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor);
+            rlCacheBlendEquation(RLGL.State.glBlendEquation, RLGL.State.glBlendEquation);
+
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            rlCacheBlendFunc(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            rlCacheBlendEquation(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+
+        } break;
+        default: break;
+    }
+}
+
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - GL state cache
+//----------------------------------------------------------------------------------
+// NOTE: OpenGL 1.1 does not use the state cache, calls are always issued
+
+// Use shader program, skipped if already in use
+static void rlCacheUseProgram(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.program == id) RLGL.Cache.callsSkipped++;
+    else
+    {
+        glUseProgram(id);
+        RLGL.Cache.program = id;
+        RLGL.Cache.callsIssued++;
+    }
+#endif
+}
+
+// Select active texture unit, skipped if already active
+static void rlCacheActiveTexture(int unit)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.activeTextureUnit == unit) RLGL.Cache.callsSkipped++;
+    else
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        RLGL.Cache.activeTextureUnit = unit;
+        RLGL.Cache.callsIssued++;
+    }
+#endif
+}
+
+// Bind 2D texture to active texture unit, skipped if already bound
+static void rlCacheBindTexture2D(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int unit = RLGL.Cache.activeTextureUnit;
+
+    // NOTE: Bindings on unknown active texture unit or units out of cache range are always issued
+    if ((unit >= 0) && (unit < RL_STATE_CACHE_TEXTURE_UNITS))
+    {
+        if (RLGL.Cache.texture2D[unit] == id)
+        {
+            RLGL.Cache.callsSkipped++;
+            return;
+        }
+
+        RLGL.Cache.texture2D[unit] = id;
+    }
+
+    RLGL.Cache.callsIssued++;
+#endif
+    glBindTexture(GL_TEXTURE_2D, id);
+}
+
+// Remove deleted texture from state cache
+// NOTE: OpenGL reverts deleted texture bindings to 0
+static void rlCacheDeleteTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.Cache.texture2D[i] == id) RLGL.Cache.texture2D[i] = 0;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Remove deleted shader program from state cache
+// NOTE: Program ids could be reused by new programs, uploaded uniforms are not valid anymore
+static void rlCacheDeleteProgram(unsigned int id)
+{
+    if (RLGL.Cache.program == id) RLGL.Cache.program = RL_STATE_CACHE_UNKNOWN;
+
+    for (int i = 0; i < RL_STATE_CACHE_SHADERS; i++)
+    {
+        if (RLGL.Cache.shaders[i].id == id) RLGL.Cache.shaders[i].id = 0;
+    }
+}
+
+// Register uniforms modification for shader program in use
+// NOTE: Batch uniforms must be uploaded again on next batch drawing
+static void rlCacheUniformsModified(void)
+{
+    for (int i = 0; i < RL_STATE_CACHE_SHADERS; i++)
+    {
+        if ((RLGL.Cache.program == RL_STATE_CACHE_UNKNOWN) || (RLGL.Cache.shaders[i].id == RLGL.Cache.program)) RLGL.Cache.shaders[i].id = 0;
+    }
+}
+
+// Upload matrix uniform, skipped if same matrix already uploaded
+static void rlCacheUniformMatrix(int location, rlMatrix *uploaded, rlMatrix mat, bool force)
+{
+    if (force || (memcmp(uploaded, &mat, sizeof(rlMatrix)) != 0))
+    {
+        glUniformMatrix4fv(location, 1, false, rlMatrixToFloat(mat));
+        *uploaded = mat;
+        RLGL.Cache.callsIssued++;
+    }
+    else RLGL.Cache.callsSkipped++;
+}
+
+// Set blending factors, skipped if already set
+static void rlCacheBlendFunc(int srcRGB, int dstRGB, int srcAlpha, int dstAlpha)
+{
+    if ((RLGL.Cache.blendSrcRGB == srcRGB) && (RLGL.Cache.blendDstRGB == dstRGB) &&
+        (RLGL.Cache.blendSrcAlpha == srcAlpha) && (RLGL.Cache.blendDstAlpha == dstAlpha)) RLGL.Cache.callsSkipped++;
+    else
+    {
+        if ((srcRGB == srcAlpha) && (dstRGB == dstAlpha)) glBlendFunc(srcRGB, dstRGB);
+        else glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+        RLGL.Cache.blendSrcRGB = srcRGB;
+        RLGL.Cache.blendDstRGB = dstRGB;
+        RLGL.Cache.blendSrcAlpha = srcAlpha;
+        RLGL.Cache.blendDstAlpha = dstAlpha;
+        RLGL.Cache.callsIssued++;
+    }
+}
+
+// Set blending equations, skipped if already set
+static void rlCacheBlendEquation(int equationRGB, int equationAlpha)
+{
+    if ((RLGL.Cache.blendEquationRGB == equationRGB) && (RLGL.Cache.blendEquationAlpha == equationAlpha)) RLGL.Cache.callsSkipped++;
+    else
+    {
+        if (equationRGB == equationAlpha) glBlendEquation(equationRGB);
+        else glBlendEquationSeparate(equationRGB, equationAlpha);
+
+        RLGL.Cache.blendEquationRGB = equationRGB;
+        RLGL.Cache.blendEquationAlpha = equationAlpha;
+        RLGL.Cache.callsIssued++;
+    }
+}
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+#if defined(GRAPHICS_API_NULL)
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Null graphics backend (recording)
+//----------------------------------------------------------------------------------
+// NOTE: OpenGL functions are replaced by recording functions loaded through glad,
+// no GPU or graphics context required, rlgl batching and state management run unchanged
+
+// Register recorded command into stats and command stream
+static void rlNullRecord(int type, unsigned int id, int count, int instances, int size)
+{
+    switch (type)
+    {
+        case RL_RECORD_DRAW:
+        {
+            RLNULL.stats.drawCalls++;
+            RLNULL.stats.vertices += (unsigned long long int)count*instances;
+        } break;
+        case RL_RECORD_UPLOAD:
+        {
+            RLNULL.stats.uploads++;
+            RLNULL.stats.uploadedBytes += (unsigned long long int)size;
+        } break;
+        case RL_RECORD_TEXTURE_BIND: RLNULL.stats.textureBinds++; break;
+        case RL_RECORD_SHADER_BIND: RLNULL.stats.shaderBinds++; break;
+        case RL_RECORD_UNIFORM: RLNULL.stats.uniformUploads++; break;
+        case RL_RECORD_STATE: RLNULL.stats.stateChanges++; break;
+        case RL_RECORD_CLEAR: RLNULL.stats.clears++; break;
+        default: break;
+    }
+
+    if ((RLNULL.commands != NULL) && (RLNULL.stats.commandCount < RL_NULL_MAX_RECORD_COMMANDS))
+    {
+        rlRecordCommand *command = &RLNULL.commands[RLNULL.stats.commandCount];
+        command->type = type;
+        command->id = id;
+        command->count = count;
+        command->instances = instances;
+        command->size = size;
+
+        RLNULL.stats.commandCount++;
+    }
+    else RLNULL.stats.commandsDropped++;
+}
+
+// Get pixel data size in bytes for OpenGL format and type
+static int rlNullPixelDataSize(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    int channels = 4;
+    int channelSize = 1;
+
+    switch (format)
+    {
+        case GL_RED:
+        case GL_DEPTH_COMPONENT: channels = 1; break;
+        case GL_RG: channels = 2; break;
+        case GL_RGB: channels = 3; break;
+        default: break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_4_4_4_4: channels = 1; channelSize = 2; break;
+        case GL_HALF_FLOAT: channelSize = 2; break;
+        case GL_FLOAT:
+        case GL_UNSIGNED_INT: channelSize = 4; break;
+        default: break;
+    }
+
+    return width*height*channels*channelSize;
+}
+
+// Generate object names
+static void rlNullGenNames(GLsizei n, GLuint *names)
+{
+    for (int i = 0; i < n; i++) names[i] = RLNULL.nextId++;
+}
+
+// Null OpenGL functions: objects creation and deletion
+static void GLAD_API_PTR rlNullGenBuffers(GLsizei n, GLuint *buffers) { rlNullGenNames(n, buffers); }
+static void GLAD_API_PTR rlNullGenFramebuffers(GLsizei n, GLuint *framebuffers) { rlNullGenNames(n, framebuffers); }
+static void GLAD_API_PTR rlNullGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { rlNullGenNames(n, renderbuffers); }
+static void GLAD_API_PTR rlNullGenTextures(GLsizei n, GLuint *textures) { rlNullGenNames(n, textures); }
+static void GLAD_API_PTR rlNullGenVertexArrays(GLsizei n, GLuint *arrays) { rlNullGenNames(n, arrays); }
+static GLuint GLAD_API_PTR rlNullCreateProgram(void) { return rlNullAddShader(RLNULL.nextId++, 0); }
+static GLuint GLAD_API_PTR rlNullCreateShader(GLenum type) { return rlNullAddShader(RLNULL.nextId++, type); }
+static void GLAD_API_PTR rlNullDeleteBuffers(GLsizei n, const GLuint *buffers) { }
+static void GLAD_API_PTR rlNullDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { }
+static void GLAD_API_PTR rlNullDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { }
+static void GLAD_API_PTR rlNullDeleteTextures(GLsizei n, const GLuint *textures) { }
+static void GLAD_API_PTR rlNullDeleteVertexArrays(GLsizei n, const GLuint *arrays) { }
+static void GLAD_API_PTR rlNullDeleteProgram(GLuint program) { rlNullDeleteObject(program); }
+static void GLAD_API_PTR rlNullDeleteShader(GLuint shader) { rlNullDeleteObject(shader); }
+static GLsync GLAD_API_PTR rlNullFenceSync(GLenum condition, GLbitfield flags) { return NULL; }
+static GLenum GLAD_API_PTR rlNullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { return GL_ALREADY_SIGNALED; }
+static void GLAD_API_PTR rlNullDeleteSync(GLsync sync) { }
+static void GLAD_API_PTR rlNullGenQueries(GLsizei n, GLuint *ids) { rlNullGenNames(n, ids); }
+static void GLAD_API_PTR rlNullDeleteQueries(GLsizei n, const GLuint *ids) { }
+static void GLAD_API_PTR rlNullQueryCounter(GLuint id, GLenum target) { }
+static void GLAD_API_PTR rlNullGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { *params = (pname == GL_QUERY_RESULT_AVAILABLE)? GL_TRUE : 0; }
+static void GLAD_API_PTR rlNullGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { *params = 0; }     // No GPU work, timestamps are 0
+
+// Null OpenGL functions: shaders
+static void GLAD_API_PTR rlNullCompileShader(GLuint shader) { }
+static void GLAD_API_PTR rlNullBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { }
+
+// Set shader source code, kept to find declared variables
+static void GLAD_API_PTR rlNullShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+{
+    rlNullShader *object = rlNullGetShader(shader);
+    if (object == NULL) return;
+
+    int size = 0;
+    for (int i = 0; i < count; i++) size += ((length != NULL) && (length[i] >= 0))? length[i] : (int)strlen(string[i]);
+
+    char *code = (char *)RL_MALLOC(size + 1);
+    if (code == NULL) return;
+
+    for (int i = 0, offset = 0; i < count; i++)
+    {
+        int stringSize = ((length != NULL) && (length[i] >= 0))? length[i] : (int)strlen(string[i]);
+        memcpy(code + offset, string[i], stringSize);
+        offset += stringSize;
+    }
+    code[size] = '\0';
+
+    RL_FREE(object->code);
+    object->code = code;
+}
+
+static void GLAD_API_PTR rlNullAttachShader(GLuint program, GLuint shader)
+{
+    rlNullShader *object = rlNullGetShader(shader);
+    if (object != NULL) object->program = program;
+}
+
+static void GLAD_API_PTR rlNullDetachShader(GLuint program, GLuint shader)
+{
+    rlNullShader *object = rlNullGetShader(shader);
+    if ((object != NULL) && (object->program == program)) object->program = 0;
+}
+
+// Link program, attached shaders source code is kept by program (shaders can be deleted after linking)
+// NOTE: Vertex shaders source code is also kept separately, vertex attributes are only declared there
+static void GLAD_API_PTR rlNullLinkProgram(GLuint program)
+{
+    rlNullShader *object = rlNullGetShader(program);
+    if (object == NULL) return;
+
+    int size = 0;
+    int vertexSize = 0;
+    for (int i = 0; i < RLNULL.shaderCount; i++)
+    {
+        if ((RLNULL.shaders[i].program == program) && (RLNULL.shaders[i].code != NULL))
+        {
+            size += (int)strlen(RLNULL.shaders[i].code) + 1;
+            if (RLNULL.shaders[i].type == GL_VERTEX_SHADER) vertexSize += (int)strlen(RLNULL.shaders[i].code) + 1;
+        }
+    }
+
+    char *code = (char *)RL_CALLOC(size + 1, 1);
+    char *vertexCode = (char *)RL_CALLOC(vertexSize + 1, 1);
+    if ((code == NULL) || (vertexCode == NULL))
+    {
+        RL_FREE(code);
+        RL_FREE(vertexCode);
+        return;
+    }
+
+    for (int i = 0; i < RLNULL.shaderCount; i++)
+    {
+        if ((RLNULL.shaders[i].program == program) && (RLNULL.shaders[i].code != NULL))
+        {
+            strcat(code, RLNULL.shaders[i].code);
+            strcat(code, "\n");
+
+            if (RLNULL.shaders[i].type == GL_VERTEX_SHADER)
+            {
+                strcat(vertexCode, RLNULL.shaders[i].code);
+                strcat(vertexCode, "\n");
+            }
+        }
+    }
+
+    RL_FREE(object->code);
+    RL_FREE(object->vertexCode);
+    object->code = code;
+    object->vertexCode = vertexCode;
+}
+
+static void GLAD_API_PTR rlNullGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0;
+}
+
+static void GLAD_API_PTR rlNullGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    *params = (pname == GL_LINK_STATUS)? GL_TRUE : 0;
+}
+
+static void GLAD_API_PTR rlNullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+// Get attribute location, default attributes are bound to default locations (as rlLoadShaderProgram())
+// NOTE: Attributes not declared in program vertex shaders source code return -1, as OpenGL does,
+// other attributes get a location after default ones, from their declaration index
+static GLint GLAD_API_PTR rlNullGetAttribLocation(GLuint program, const GLchar *name)
+{
+    rlNullShader *object = rlNullGetShader(program);
+    if (object == NULL) return -1;
+
+    // NOTE: GLSL 100 declares vertex attributes with "attribute" qualifier, GLSL 330 with "in"
+    int index = rlNullFindDeclaration(object->vertexCode, "in", name);
+    if (index == -1) index = rlNullFindDeclaration(object->vertexCode, "attribute", name);
+    if (index == -1) return -1;
+
+    GLint location = RL_NULL_CUSTOM_ATTRIB_LOCATION + index;
+
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT;
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS;
+#endif
+
+    return location;
+}
+
+// Get uniform location, deterministic location computed from uniform name
+// NOTE: Uniforms not declared in program shaders source code return -1, as OpenGL does
+static GLint GLAD_API_PTR rlNullGetUniformLocation(GLuint program, const GLchar *name)
+{
+    rlNullShader *object = rlNullGetShader(program);
+    if ((object == NULL) || (rlNullFindDeclaration(object->code, "uniform", name) == -1)) return -1;
+
+    unsigned int hash = 5381;
+    for (int i = 0; name[i] != '\0'; i++) hash = hash*33 + (unsigned char)name[i];
+
+    return (GLint)(hash%1024);
+}
+
+// Null OpenGL functions: queries
+static const GLubyte *GLAD_API_PTR rlNullGetString(GLenum name)
+{
+    const char *string = "";
+
+    switch (name)
+    {
+        case GL_VENDOR: string = "raylib"; break;
+        case GL_RENDERER: string = "rlgl null backend (recording)"; break;
+        case GL_VERSION: string = "3.3 rlgl null"; break;
+        case GL_SHADING_LANGUAGE_VERSION: string = "3.30"; break;
+        default: break;
+    }
+
+    return (const GLubyte *)string;
+}
+
+// NOTE: Only VAO extension reported, required by glad extensions loading
+static const GLubyte *GLAD_API_PTR rlNullGetStringi(GLenum name, GLuint index) { return (const GLubyte *)"GL_ARB_vertex_array_object"; }
+static GLenum GLAD_API_PTR rlNullGetError(void) { return GL_NO_ERROR; }
+static GLenum GLAD_API_PTR rlNullCheckFramebufferStatus(GLenum target) { return GL_FRAMEBUFFER_COMPLETE; }
+
+static void GLAD_API_PTR rlNullGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_MAJOR_VERSION:
+        case GL_MINOR_VERSION: data[0] = 3; break;
+        case GL_MAX_TEXTURE_SIZE:
+        case GL_MAX_RENDERBUFFER_SIZE: data[0] = 16384; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 16; break;
+        case GL_MAX_COLOR_ATTACHMENTS:
+        case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+        case GL_FRAMEBUFFER_BINDING: data[0] = (GLint)RLNULL.framebuffer; break;
+        case GL_VIEWPORT: for (int i = 0; i < 4; i++) data[i] = RLNULL.viewport[i]; break;
+        case GL_NUM_EXTENSIONS: data[0] = 1; break;
+        default: data[0] = 0; break;
+    }
+}
+
+static void GLAD_API_PTR rlNullGetFloatv(GLenum pname, GLfloat *data) { data[0] = 0.0f; }
+static void GLAD_API_PTR rlNullGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { *params = 0; }
+
+// Read pixels, no rendering is done, pixels are set to 0
+static void GLAD_API_PTR rlNullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    memset(pixels, 0, rlNullPixelDataSize(width, height, format, type));
+}
+
+// NOTE: Texture size is not tracked, pixels are not written
+static void GLAD_API_PTR rlNullGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { }
+
+// Null OpenGL functions: data uploads
+static void GLAD_API_PTR rlNullBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    if (data != NULL) rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, (int)size);
+}
+
+static void GLAD_API_PTR rlNullBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    if (data != NULL) rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, (int)size);
+}
+
+static void GLAD_API_PTR rlNullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, (int)size);
+}
+
+static void *GLAD_API_PTR rlNullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { return NULL; }
+
+static void GLAD_API_PTR rlNullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    if (pixels != NULL) rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, rlNullPixelDataSize(width, height, format, type));
+}
+
+static void GLAD_API_PTR rlNullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, rlNullPixelDataSize(width, height, format, type));
+}
+
+static void GLAD_API_PTR rlNullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    if (data != NULL) rlNullRecord(RL_RECORD_UPLOAD, target, 0, 0, imageSize);
+}
+
+// Null OpenGL functions: textures
+static void GLAD_API_PTR rlNullBindTexture(GLenum target, GLuint texture) { rlNullRecord(RL_RECORD_TEXTURE_BIND, texture, 0, 0, 0); }
+static void GLAD_API_PTR rlNullActiveTexture(GLenum texture) { rlNullRecord(RL_RECORD_STATE, texture, 0, 0, 0); }
+static void GLAD_API_PTR rlNullTexParameterf(GLenum target, GLenum pname, GLfloat param) { }
+static void GLAD_API_PTR rlNullTexParameteri(GLenum target, GLenum pname, GLint param) { }
+static void GLAD_API_PTR rlNullTexParameteriv(GLenum target, GLenum pname, const GLint *params) { }
+static void GLAD_API_PTR rlNullGenerateMipmap(GLenum target) { }
+static void GLAD_API_PTR rlNullPixelStorei(GLenum pname, GLint param) { }
+
+// Null OpenGL functions: shader program and uniforms
+static void GLAD_API_PTR rlNullUseProgram(GLuint program) { rlNullRecord(RL_RECORD_SHADER_BIND, program, 0, 0, 0); }
+static void GLAD_API_PTR rlNullUniform1i(GLint location, GLint v0) { rlNullRecord(RL_RECORD_UNIFORM, location, 1, 0, sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { rlNullRecord(RL_RECORD_UNIFORM, location, 1, 0, 4*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform1fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform2fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*2*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform3fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*3*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform4fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*4*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform1iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform2iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*2*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform3iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*3*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform4iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*4*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform1uiv(GLint location, GLsizei count, const GLuint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*sizeof(GLuint)); }
+static void GLAD_API_PTR rlNullUniform2uiv(GLint location, GLsizei count, const GLuint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*2*sizeof(GLuint)); }
+static void GLAD_API_PTR rlNullUniform3uiv(GLint location, GLsizei count, const GLuint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*3*sizeof(GLuint)); }
+static void GLAD_API_PTR rlNullUniform4uiv(GLint location, GLsizei count, const GLuint *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*4*sizeof(GLuint)); }
+static void GLAD_API_PTR rlNullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { rlNullRecord(RL_RECORD_UNIFORM, location, count, 0, count*16*sizeof(GLfloat)); }
+
+// Null OpenGL functions: vertex arrays and buffers
+static void GLAD_API_PTR rlNullBindVertexArray(GLuint array) { rlNullRecord(RL_RECORD_STATE, array, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBindBuffer(GLenum target, GLuint buffer) { rlNullRecord(RL_RECORD_STATE, buffer, 0, 0, 0); }
+static void GLAD_API_PTR rlNullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { }
+static void GLAD_API_PTR rlNullEnableVertexAttribArray(GLuint index) { }
+static void GLAD_API_PTR rlNullDisableVertexAttribArray(GLuint index) { }
+static void GLAD_API_PTR rlNullVertexAttribDivisor(GLuint index, GLuint divisor) { }
+static void GLAD_API_PTR rlNullVertexAttrib1fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib2fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib3fv(GLuint index, const GLfloat *v) { }
+static void GLAD_API_PTR rlNullVertexAttrib4fv(GLuint index, const GLfloat *v) { }
+
+// Null OpenGL functions: drawing
+static void GLAD_API_PTR rlNullDrawArrays(GLenum mode, GLint first, GLsizei count) { rlNullRecord(RL_RECORD_DRAW, mode, count, 1, 0); }
+static void GLAD_API_PTR rlNullDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { rlNullRecord(RL_RECORD_DRAW, mode, count, 1, 0); }
+static void GLAD_API_PTR rlNullDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { rlNullRecord(RL_RECORD_DRAW, mode, count, instancecount, 0); }
+static void GLAD_API_PTR rlNullDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { rlNullRecord(RL_RECORD_DRAW, mode, count, instancecount, 0); }
+static void GLAD_API_PTR rlNullClear(GLbitfield mask) { rlNullRecord(RL_RECORD_CLEAR, mask, 0, 0, 0); }
+static void GLAD_API_PTR rlNullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { }
+static void GLAD_API_PTR rlNullClearDepth(GLdouble depth) { }
+
+// Null OpenGL functions: pipeline state
+static void GLAD_API_PTR rlNullEnable(GLenum cap) { rlNullRecord(RL_RECORD_STATE, cap, 1, 0, 0); }
+static void GLAD_API_PTR rlNullDisable(GLenum cap) { rlNullRecord(RL_RECORD_STATE, cap, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBlendFunc(GLenum sfactor, GLenum dfactor) { rlNullRecord(RL_RECORD_STATE, GL_BLEND_SRC_RGB, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { rlNullRecord(RL_RECORD_STATE, GL_BLEND_SRC_RGB, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBlendEquation(GLenum mode) { rlNullRecord(RL_RECORD_STATE, GL_BLEND_EQUATION_RGB, 0, 0, 0); }
+static void GLAD_API_PTR rlNullBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { rlNullRecord(RL_RECORD_STATE, GL_BLEND_EQUATION_RGB, 0, 0, 0); }
+static void GLAD_API_PTR rlNullDepthFunc(GLenum func) { rlNullRecord(RL_RECORD_STATE, GL_DEPTH_FUNC, 0, 0, 0); }
+static void GLAD_API_PTR rlNullDepthMask(GLboolean flag) { rlNullRecord(RL_RECORD_STATE, GL_DEPTH_WRITEMASK, 0, 0, 0); }
+static void GLAD_API_PTR rlNullColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { rlNullRecord(RL_RECORD_STATE, GL_COLOR_WRITEMASK, 0, 0, 0); }
+static void GLAD_API_PTR rlNullCullFace(GLenum mode) { rlNullRecord(RL_RECORD_STATE, GL_CULL_FACE_MODE, 0, 0, 0); }
+static void GLAD_API_PTR rlNullFrontFace(GLenum mode) { rlNullRecord(RL_RECORD_STATE, GL_FRONT_FACE, 0, 0, 0); }
+static void GLAD_API_PTR rlNullLineWidth(GLfloat width) { rlNullRecord(RL_RECORD_STATE, GL_LINE_WIDTH, 0, 0, 0); }
+static void GLAD_API_PTR rlNullPolygonMode(GLenum face, GLenum mode) { rlNullRecord(RL_RECORD_STATE, GL_POLYGON_MODE, 0, 0, 0); }
+static void GLAD_API_PTR rlNullScissor(GLint x, GLint y, GLsizei width, GLsizei height) { rlNullRecord(RL_RECORD_STATE, GL_SCISSOR_BOX, 0, 0, 0); }
+
+static void GLAD_API_PTR rlNullViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RLNULL.viewport[0] = x;
+    RLNULL.viewport[1] = y;
+    RLNULL.viewport[2] = width;
+    RLNULL.viewport[3] = height;
+
+    rlNullRecord(RL_RECORD_STATE, GL_VIEWPORT, 0, 0, 0);
+}
+
+// Null OpenGL functions: framebuffers
+static void GLAD_API_PTR rlNullBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    RLNULL.framebuffer = framebuffer;
+    rlNullRecord(RL_RECORD_STATE, framebuffer, 0, 0, 0);
+}
+
+static void GLAD_API_PTR rlNullBindRenderbuffer(GLenum target, GLuint renderbuffer) { }
+static void GLAD_API_PTR rlNullRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { }
+static void GLAD_API_PTR rlNullFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { }
+static void GLAD_API_PTR rlNullFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { }
+static void GLAD_API_PTR rlNullDrawBuffers(GLsizei n, const GLenum *bufs) { }
+static void GLAD_API_PTR rlNullBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { rlNullRecord(RL_RECORD_DRAW, GL_NONE, 0, 0, 0); }
+
+// Get null OpenGL function address by name
+// NOTE: Used as glad loader, functions not available are returned as NULL
+// Add null shader or program object, returns object id
+// NOTE: Object is not tracked if objects array can't grow, no variables are declared for it
+static unsigned int rlNullAddShader(unsigned int id, unsigned int type)
+{
+    rlNullShader *shaders = (rlNullShader *)RL_REALLOC(RLNULL.shaders, (RLNULL.shaderCount + 1)*sizeof(rlNullShader));
+
+    if (shaders != NULL)
+    {
+        RLNULL.shaders = shaders;
+        RLNULL.shaders[RLNULL.shaderCount].id = id;
+        RLNULL.shaders[RLNULL.shaderCount].type = type;
+        RLNULL.shaders[RLNULL.shaderCount].program = 0;
+        RLNULL.shaders[RLNULL.shaderCount].code = NULL;
+        RLNULL.shaders[RLNULL.shaderCount].vertexCode = NULL;
+        RLNULL.shaderCount++;
+    }
+
+    return id;
+}
+
+// Get null shader or program object by id
+static rlNullShader *rlNullGetShader(unsigned int id)
+{
+    for (int i = 0; i < RLNULL.shaderCount; i++)
+    {
+        if (RLNULL.shaders[i].id == id) return &RLNULL.shaders[i];
+    }
+
+    return NULL;
+}
+
+// Delete null shader or program object, last object moved to its place
+static void rlNullDeleteObject(unsigned int id)
+{
+    rlNullShader *object = rlNullGetShader(id);
+    if (object == NULL) return;
+
+    RL_FREE(object->code);
+    RL_FREE(object->vertexCode);
+    *object = RLNULL.shaders[RLNULL.shaderCount - 1];
+    RLNULL.shaderCount--;
+}
+
+// Check if character is part of a GLSL identifier
+static bool rlNullIsNameChar(char c)
+{
+    return (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_'));
+}
+
+// Find variable declared with qualifier in shader code ("uniform vec4 colDiffuse;"), returns declaration index or -1
+// NOTE: Array elements and struct members are found by variable name: "lights[0].color" -> "lights"
+static int rlNullFindDeclaration(const char *code, const char *qualifier, const char *name)
+{
+    if (code == NULL) return -1;
+
+    int nameLength = 0;
+    while ((name[nameLength] != '\0') && (name[nameLength] != '[') && (name[nameLength] != '.')) nameLength++;
+
+    int qualifierLength = (int)strlen(qualifier);
+    int index = 0;
+
+    for (const char *c = code; *c != '\0'; c++)
+    {
+        // Qualifier must be a whole word
+        if ((strncmp(c, qualifier, qualifierLength) != 0) || ((c > code) && rlNullIsNameChar(c[-1])) || rlNullIsNameChar(c[qualifierLength])) continue;
+
+        // Declaration: [precision] type name[size], name...;
+        // NOTE: Variable names are the words followed by ',', ';', '[' or '=', words between brackets are skipped
+        int depth = 0;
+        c += qualifierLength;
+
+        while ((*c != '\0') && (*c != ';') && (*c != '{'))
+        {
+            if (*c == '[') depth++;
+            else if (*c == ']') depth--;
+            else if ((depth == 0) && rlNullIsNameChar(*c))
+            {
+                int length = 0;
+                while (rlNullIsNameChar(c[length])) length++;
+
+                const char *next = c + length;
+                while ((*next == ' ') || (*next == '\t') || (*next == '\r') || (*next == '\n')) next++;
+
+                if ((*next == ',') || (*next == ';') || (*next == '[') || (*next == '='))
+                {
+                    if ((length == nameLength) && (strncmp(c, name, nameLength) == 0)) return index;
+                    index++;
+                }
+
+                c += length - 1;
+            }
+
+            c++;
+        }
+
+        if (*c == '\0') break;
+    }
+
+    return -1;
+}
+
+static GLADapiproc rlNullGetProcAddress(const char *name)
+{
+    static const struct {
+        const char *name;
+        GLADapiproc proc;
+    } procs[] = {
+        { "glActiveTexture", (GLADapiproc)rlNullActiveTexture },
+        { "glAttachShader", (GLADapiproc)rlNullAttachShader },
+        { "glBindAttribLocation", (GLADapiproc)rlNullBindAttribLocation },
+        { "glBindBuffer", (GLADapiproc)rlNullBindBuffer },
+        { "glBindFramebuffer", (GLADapiproc)rlNullBindFramebuffer },
+        { "glBindRenderbuffer", (GLADapiproc)rlNullBindRenderbuffer },
+        { "glBindTexture", (GLADapiproc)rlNullBindTexture },
+        { "glBindVertexArray", (GLADapiproc)rlNullBindVertexArray },
+        { "glBlendEquation", (GLADapiproc)rlNullBlendEquation },
+        { "glBlendEquationSeparate", (GLADapiproc)rlNullBlendEquationSeparate },
+        { "glBlendFunc", (GLADapiproc)rlNullBlendFunc },
+        { "glBlendFuncSeparate", (GLADapiproc)rlNullBlendFuncSeparate },
+        { "glBlitFramebuffer", (GLADapiproc)rlNullBlitFramebuffer },
+        { "glBufferData", (GLADapiproc)rlNullBufferData },
+        { "glBufferStorage", (GLADapiproc)rlNullBufferStorage },
+        { "glBufferSubData", (GLADapiproc)rlNullBufferSubData },
+        { "glCheckFramebufferStatus", (GLADapiproc)rlNullCheckFramebufferStatus },
+        { "glClear", (GLADapiproc)rlNullClear },
+        { "glClearColor", (GLADapiproc)rlNullClearColor },
+        { "glClearDepth", (GLADapiproc)rlNullClearDepth },
+        { "glClientWaitSync", (GLADapiproc)rlNullClientWaitSync },
+        { "glColorMask", (GLADapiproc)rlNullColorMask },
+        { "glCompileShader", (GLADapiproc)rlNullCompileShader },
+        { "glCompressedTexImage2D", (GLADapiproc)rlNullCompressedTexImage2D },
+        { "glCreateProgram", (GLADapiproc)rlNullCreateProgram },
+        { "glCreateShader", (GLADapiproc)rlNullCreateShader },
+        { "glCullFace", (GLADapiproc)rlNullCullFace },
+        { "glDeleteBuffers", (GLADapiproc)rlNullDeleteBuffers },
+        { "glDeleteFramebuffers", (GLADapiproc)rlNullDeleteFramebuffers },
+        { "glDeleteProgram", (GLADapiproc)rlNullDeleteProgram },
+        { "glDeleteQueries", (GLADapiproc)rlNullDeleteQueries },
+        { "glDeleteRenderbuffers", (GLADapiproc)rlNullDeleteRenderbuffers },
+        { "glDeleteShader", (GLADapiproc)rlNullDeleteShader },
+        { "glDeleteSync", (GLADapiproc)rlNullDeleteSync },
+        { "glDeleteTextures", (GLADapiproc)rlNullDeleteTextures },
+        { "glDeleteVertexArrays", (GLADapiproc)rlNullDeleteVertexArrays },
+        { "glDepthFunc", (GLADapiproc)rlNullDepthFunc },
+        { "glDepthMask", (GLADapiproc)rlNullDepthMask },
+        { "glDetachShader", (GLADapiproc)rlNullDetachShader },
+        { "glDisable", (GLADapiproc)rlNullDisable },
+        { "glDisableVertexAttribArray", (GLADapiproc)rlNullDisableVertexAttribArray },
+        { "glDrawArrays", (GLADapiproc)rlNullDrawArrays },
+        { "glDrawArraysInstanced", (GLADapiproc)rlNullDrawArraysInstanced },
+        { "glDrawBuffers", (GLADapiproc)rlNullDrawBuffers },
+        { "glDrawElements", (GLADapiproc)rlNullDrawElements },
+        { "glDrawElementsInstanced", (GLADapiproc)rlNullDrawElementsInstanced },
+        { "glEnable", (GLADapiproc)rlNullEnable },
+        { "glEnableVertexAttribArray", (GLADapiproc)rlNullEnableVertexAttribArray },
+        { "glFenceSync", (GLADapiproc)rlNullFenceSync },
+        { "glFramebufferRenderbuffer", (GLADapiproc)rlNullFramebufferRenderbuffer },
+        { "glFramebufferTexture2D", (GLADapiproc)rlNullFramebufferTexture2D },
+        { "glFrontFace", (GLADapiproc)rlNullFrontFace },
+        { "glGenBuffers", (GLADapiproc)rlNullGenBuffers },
+        { "glGenFramebuffers", (GLADapiproc)rlNullGenFramebuffers },
+        { "glGenQueries", (GLADapiproc)rlNullGenQueries },
+        { "glGenRenderbuffers", (GLADapiproc)rlNullGenRenderbuffers },
+        { "glGenTextures", (GLADapiproc)rlNullGenTextures },
+        { "glGenVertexArrays", (GLADapiproc)rlNullGenVertexArrays },
+        { "glGenerateMipmap", (GLADapiproc)rlNullGenerateMipmap },
+        { "glGetAttribLocation", (GLADapiproc)rlNullGetAttribLocation },
+        { "glGetError", (GLADapiproc)rlNullGetError },
+        { "glGetFloatv", (GLADapiproc)rlNullGetFloatv },
+        { "glGetFramebufferAttachmentParameteriv", (GLADapiproc)rlNullGetFramebufferAttachmentParameteriv },
+        { "glGetIntegerv", (GLADapiproc)rlNullGetIntegerv },
+        { "glGetProgramInfoLog", (GLADapiproc)rlNullGetProgramInfoLog },
+        { "glGetProgramiv", (GLADapiproc)rlNullGetProgramiv },
+        { "glGetQueryObjectiv", (GLADapiproc)rlNullGetQueryObjectiv },
+        { "glGetQueryObjectui64v", (GLADapiproc)rlNullGetQueryObjectui64v },
+        { "glGetShaderInfoLog", (GLADapiproc)rlNullGetShaderInfoLog },
+        { "glGetShaderiv", (GLADapiproc)rlNullGetShaderiv },
+        { "glGetString", (GLADapiproc)rlNullGetString },
+        { "glGetStringi", (GLADapiproc)rlNullGetStringi },
+        { "glGetTexImage", (GLADapiproc)rlNullGetTexImage },
+        { "glGetUniformLocation", (GLADapiproc)rlNullGetUniformLocation },
+        { "glLineWidth", (GLADapiproc)rlNullLineWidth },
+        { "glLinkProgram", (GLADapiproc)rlNullLinkProgram },
+        { "glMapBufferRange", (GLADapiproc)rlNullMapBufferRange },
+        { "glPixelStorei", (GLADapiproc)rlNullPixelStorei },
+        { "glPolygonMode", (GLADapiproc)rlNullPolygonMode },
+        { "glQueryCounter", (GLADapiproc)rlNullQueryCounter },
+        { "glReadPixels", (GLADapiproc)rlNullReadPixels },
+        { "glRenderbufferStorage", (GLADapiproc)rlNullRenderbufferStorage },
+        { "glScissor", (GLADapiproc)rlNullScissor },
+        { "glShaderSource", (GLADapiproc)rlNullShaderSource },
+        { "glTexImage2D", (GLADapiproc)rlNullTexImage2D },
+        { "glTexParameterf", (GLADapiproc)rlNullTexParameterf },
+        { "glTexParameteri", (GLADapiproc)rlNullTexParameteri },
+        { "glTexParameteriv", (GLADapiproc)rlNullTexParameteriv },
+        { "glTexSubImage2D", (GLADapiproc)rlNullTexSubImage2D },
+        { "glUniform1fv", (GLADapiproc)rlNullUniform1fv },
+        { "glUniform1i", (GLADapiproc)rlNullUniform1i },
+        { "glUniform1iv", (GLADapiproc)rlNullUniform1iv },
+        { "glUniform1uiv", (GLADapiproc)rlNullUniform1uiv },
+        { "glUniform2fv", (GLADapiproc)rlNullUniform2fv },
+        { "glUniform2iv", (GLADapiproc)rlNullUniform2iv },
+        { "glUniform2uiv", (GLADapiproc)rlNullUniform2uiv },
+        { "glUniform3fv", (GLADapiproc)rlNullUniform3fv },
+        { "glUniform3iv", (GLADapiproc)rlNullUniform3iv },
+        { "glUniform3uiv", (GLADapiproc)rlNullUniform3uiv },
+        { "glUniform4f", (GLADapiproc)rlNullUniform4f },
+        { "glUniform4fv", (GLADapiproc)rlNullUniform4fv },
+        { "glUniform4iv", (GLADapiproc)rlNullUniform4iv },
+        { "glUniform4uiv", (GLADapiproc)rlNullUniform4uiv },
+        { "glUniformMatrix4fv", (GLADapiproc)rlNullUniformMatrix4fv },
+        { "glUseProgram", (GLADapiproc)rlNullUseProgram },
+        { "glVertexAttrib1fv", (GLADapiproc)rlNullVertexAttrib1fv },
+        { "glVertexAttrib2fv", (GLADapiproc)rlNullVertexAttrib2fv },
+        { "glVertexAttrib3fv", (GLADapiproc)rlNullVertexAttrib3fv },
+        { "glVertexAttrib4fv", (GLADapiproc)rlNullVertexAttrib4fv },
+        { "glVertexAttribDivisor", (GLADapiproc)rlNullVertexAttribDivisor },
+        { "glVertexAttribPointer", (GLADapiproc)rlNullVertexAttribPointer },
+        { "glViewport", (GLADapiproc)rlNullViewport },
+    };
+
+    for (int i = 0; i < (int)(sizeof(procs)/sizeof(procs[0])); i++)
+    {
+        if (strcmp(procs[i].name, name) == 0) return procs[i].proc;
+    }
+
+    return NULL;
+}
+#endif  // GRAPHICS_API_NULL
+
+// Get pixel data size in bytes (image or texture)
+// NOTE: Size depends on pixel format
+static int rlGetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    double bytesPerPixel = (double)bpp/8.0;
+    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks,
+    // if texture is smaller, minimum dataSize is 8 or 16
+    if ((width < 4) && (height < 4))
+    {
+        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
+        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+    }
+
+    return dataSize;
+}
+
+// Auxiliar math functions
+
+// Get float array of matrix data
+static rl_float16 rlMatrixToFloatV(rlMatrix mat)
+{
+    rl_float16 result = { 0 };
+
+    result.v[0] = mat.m0;
+    result.v[1] = mat.m1;
+    result.v[2] = mat.m2;
+    result.v[3] = mat.m3;
+    result.v[4] = mat.m4;
+    result.v[5] = mat.m5;
+    result.v[6] = mat.m6;
+    result.v[7] = mat.m7;
+    result.v[8] = mat.m8;
+    result.v[9] = mat.m9;
+    result.v[10] = mat.m10;
+    result.v[11] = mat.m11;
+    result.v[12] = mat.m12;
+    result.v[13] = mat.m13;
+    result.v[14] = mat.m14;
     result.v[15] = mat.m15;
 
     return result;
@@ -5114,6 +7954,50 @@ static rlMatrix rlMatrixIdentity(void)
     return result;
 }
 
+// Get rotation matrix from axis and angle
+// NOTE: The provided angle must be in degrees
+static rlMatrix rlMatrixRotate(float angle, float x, float y, float z)
+{
+    rlMatrix matRotation = rlMatrixIdentity();
+
+    // Axis vector (x, y, z) normalization
+    float lengthSquared = x*x + y*y + z*z;
+    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
+    {
+        float inverseLength = 1.0f/sqrtf(lengthSquared);
+        x *= inverseLength;
+        y *= inverseLength;
+        z *= inverseLength;
+    }
+
+    // Rotation matrix generation
+    float sinres = sinf(DEG2RAD*angle);
+    float cosres = cosf(DEG2RAD*angle);
+    float t = 1.0f - cosres;
+
+    matRotation.m0 = x*x*t + cosres;
+    matRotation.m1 = y*x*t + z*sinres;
+    matRotation.m2 = z*x*t - y*sinres;
+    matRotation.m3 = 0.0f;
+
+    matRotation.m4 = x*y*t - z*sinres;
+    matRotation.m5 = y*y*t + cosres;
+    matRotation.m6 = z*y*t + x*sinres;
+    matRotation.m7 = 0.0f;
+
+    matRotation.m8 = x*z*t + y*sinres;
+    matRotation.m9 = y*z*t - x*sinres;
+    matRotation.m10 = z*z*t + cosres;
+    matRotation.m11 = 0.0f;
+
+    matRotation.m12 = 0.0f;
+    matRotation.m13 = 0.0f;
+    matRotation.m14 = 0.0f;
+    matRotation.m15 = 1.0f;
+
+    return matRotation;
+}
+
 // Get two matrix multiplication
 // NOTE: When multiplying matrices... the order matters!
 static rlMatrix rlMatrixMultiply(rlMatrix left, rlMatrix right)
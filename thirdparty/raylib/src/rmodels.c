@@ -12,7 +12,9 @@
 *       #define SUPPORT_FILEFORMAT_GLTF
 *       #define SUPPORT_FILEFORMAT_VOX
 *       #define SUPPORT_FILEFORMAT_M3D
+*       #define SUPPORT_FILEFORMAT_RMDL
 *           Selected desired fileformats to be supported for model data loading.
+*           RMDL is raylib binary model format, cooked with rlExportModel() and loaded with no parsing
 *
 *       #define SUPPORT_MESH_GENERATION
 *           Support procedural mesh generation functions, uses external par_shapes.h library
@@ -57,6 +59,7 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -115,14 +118,6 @@
     #endif
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
-#else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
-#endif
-
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -132,22 +127,320 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MAX_INSTANCE_ATTRIBUTES
+    #define MAX_INSTANCE_ATTRIBUTES  4    // Maximum custom attributes per instance buffer
+#endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  4    // Maximum triangles per mesh BVH leaf node
+#endif
+#ifndef MAX_FILEPATH_LENGTH
+    #if defined(_WIN32)
+        #define MAX_FILEPATH_LENGTH      256    // Maximum length for filepaths (model textures paths buffers)
+    #else
+        #define MAX_FILEPATH_LENGTH     4096    // Maximum length for filepaths (model textures paths buffers)
+    #endif
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      48    // Maximum mesh BVH depth, deeper nodes become leaves
+#endif
+
+#ifndef RAY_PACKET_SIZE
+    #define RAY_PACKET_SIZE          8    // Rays tested together by batch collision functions (SIMD lanes: 4 or 8)
+#endif
+
+#ifndef AABB_TREE_STACK_SIZE
+    #define AABB_TREE_STACK_SIZE   256    // Dynamic bounding box tree queries traversal stack size (tree is balanced)
+#endif
+
+#ifndef SKINNING_BLOCK_SIZE
+    #define SKINNING_BLOCK_SIZE     64    // Vertices skinned per block by CPU skinning (jobs split mesh in blocks)
+#endif
+#ifndef ANIMATION_COMPRESSION_TOLERANCE
+    #define ANIMATION_COMPRESSION_TOLERANCE 0.0005f // Maximum pose error of loaded animations compressed keyframes
+#endif
+#ifndef ANIMATION_KEYS_MAX_SPAN
+    #define ANIMATION_KEYS_MAX_SPAN 64    // Maximum frames between compressed animation keys
+#endif
+
+#ifndef MODEL_ASYNC_TEXTURE_ID
+    #define MODEL_ASYNC_TEXTURE_ID  0x80000000 // Placeholder textures id base, textures deferred to GPU upload by async loading
+#endif
+
+#define RMDL_VERSION                 1    // RMDL binary model file format version (files of other versions are not loaded)
+#define RMDL_SECTION_ALIGNMENT      16    // RMDL sections data alignment (bytes)
+#define RMDL_TEXTURE_NONE           -1    // RMDL material map without texture
+#define RMDL_TEXTURE_DEFAULT        -2    // RMDL material map using default texture
+
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL __thread
+#endif
+
+#define MESH_BVH_BINS               12    // Mesh BVH build: SAH (surface area heuristic) bins per axis
+
+#define DEFAULT_INSTANCE_BUFFER_CAPACITY  1024  // Default instance buffer initial capacity (rlDrawMeshInstanced())
+#define INSTANCE_TRANSFORMS_CHUNK          256  // Instances transforms converted per upload (stack memory)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Rays packet, structure of arrays layout so every ray (lane) is tested with same operations
+typedef struct RayPacket {
+    float ox[RAY_PACKET_SIZE];          // Rays origin x
+    float oy[RAY_PACKET_SIZE];          // Rays origin y
+    float oz[RAY_PACKET_SIZE];          // Rays origin z
+    float dx[RAY_PACKET_SIZE];          // Rays direction x
+    float dy[RAY_PACKET_SIZE];          // Rays direction y
+    float dz[RAY_PACKET_SIZE];          // Rays direction z
+} RayPacket;
+
+// Rays batch job data, shared by all batch jobs (packets range provided by job)
+typedef struct RayBatchJob {
+    const rlRay *rays;                  // Rays to test
+    rlRayCollision *collisions;         // Collisions results (one per ray)
+    int count;                          // Rays count
+    rlVector3 center;                   // Sphere center
+    float radius;                       // Sphere radius
+    rlBoundingBox box;                  // Box
+    float triangle[9];                  // Triangle vertex positions
+    rlMesh mesh;                        // Mesh (mesh space tests)
+    rlMeshBVH bvh;                      // Mesh bounding volume hierarchy (mesh space tests)
+    rlMatrix invTransform;              // Mesh inverse transform (world to mesh space)
+    bool mirrored;                      // Mesh transform flips triangles winding
+} RayBatchJob;
+
+// Skinning bone transform, bind pose to animated pose (computed once per bone)
+// NOTE: Both transforms are blended together as one 24 floats vector
+typedef struct SkinningBone {
+    float position[12];                 // Positions transform, 3x4 matrix (row-major)
+    float normal[12];                   // Normals transform, 3x3 rotation matrix (row-major, rows padded to 4)
+} SkinningBone;
+
+// Skinning job data, mesh vertex blocks are split across jobs
+typedef struct SkinningJob {
+    rlMesh mesh;                        // Skinned mesh
+    const SkinningBone *bones;          // Bones transforms
+    int boneCount;                      // Bones count
+} SkinningJob;
+
+// Dynamic bounding box tree node
+// NOTE: Leaf nodes are proxies (proxy id is leaf node index), nodes never move when tree is rebalanced
+typedef struct AABBTreeNode {
+    rlBoundingBox box;                  // Leaf node: enlarged (fat) proxy bounds, inner node: children bounds
+    rlBoundingBox proxyBox;             // Leaf node: proxy bounds (tested by queries)
+    int parent;                         // Parent node, -1 for root (free node: next free node)
+    int child1;                         // First child node, -1 for leaf node
+    int child2;                         // Second child node, -1 for leaf node
+    int height;                         // Node height (leaf node: 0, free node: -1)
+} AABBTreeNode;
+
+// Dynamic bounding box tree
+struct rlAABBTree {
+    AABBTreeNode *nodes;                // Tree nodes (leaves and inner nodes)
+    int nodeCount;                      // Tree nodes count (including free nodes)
+    int nodeCapacity;                   // Tree nodes allocated
+    int freeNode;                       // First free node, -1 if none
+    int root;                           // Root node, -1 if tree is empty
+    float margin;                       // Proxies bounds enlargement
+};
+
+// Compressed animation track, keys of one bone transform component
+typedef struct AnimationTrack {
+    int firstKey;                       // First key index (track keys are consecutive)
+    int keyCount;                       // Keys count (1 key: constant track)
+} AnimationTrack;
+
+// Compressed animation keyframes
+// NOTE: Every bone has 3 tracks (translation, rotation, scale), values are interpolated between keys,
+// rotations are quantized to 48 bits: smallest three components (15 bits each) and largest component index
+struct rlAnimationKeys {
+    int frameCount;                     // Animation frames count
+    int boneCount;                      // Animation bones count
+    AnimationTrack *tracks;             // Bones tracks (boneCount*3)
+    bool local;                         // Keys are parent bone relative (bones are composed on sample)
+    float *vectorFrames;                // Translation and scale keys frame
+    float *vectors;                     // Translation and scale keys value (3 floats per key)
+    float *rotationFrames;              // Rotation keys frame
+    unsigned short *rotations;          // Rotation keys quantized value (3 shorts per key)
+    int vectorKeyCount;                 // Translation and scale keys count
+    int rotationKeyCount;               // Rotation keys count
+};
+
+// RMDL binary model file format, sections data mirrors raylib structs layout
+// NOTE: Data is stored with native endianness, file is a header followed by sections table and aligned sections data
+typedef enum {
+    RMDL_SECTION_MODEL = 1,             // Model info (RMDLModel)
+    RMDL_SECTION_MESH,                  // Mesh info (RMDLMesh), index: mesh
+    RMDL_SECTION_MESH_VERTICES,         // Mesh vertices (float[vertexCount*3]), index: mesh
+    RMDL_SECTION_MESH_TEXCOORDS,        // Mesh texcoords (float[vertexCount*2]), index: mesh
+    RMDL_SECTION_MESH_TEXCOORDS2,       // Mesh texcoords2 (float[vertexCount*2]), index: mesh
+    RMDL_SECTION_MESH_NORMALS,          // Mesh normals (float[vertexCount*3]), index: mesh
+    RMDL_SECTION_MESH_TANGENTS,         // Mesh tangents (float[vertexCount*4]), index: mesh
+    RMDL_SECTION_MESH_COLORS,           // Mesh colors (unsigned char[vertexCount*4]), index: mesh
+    RMDL_SECTION_MESH_INDICES,          // Mesh indices (unsigned short[triangleCount*3]), index: mesh
+    RMDL_SECTION_MESH_BONE_IDS,         // Mesh bone ids (unsigned char[vertexCount*4]), index: mesh
+    RMDL_SECTION_MESH_BONE_WEIGHTS,     // Mesh bone weights (float[vertexCount*4]), index: mesh
+    RMDL_SECTION_MESH_MATERIAL,         // Meshes material number (int[meshCount])
+    RMDL_SECTION_MATERIAL,              // Material info (RMDLMaterial), index: material
+    RMDL_SECTION_TEXTURE,               // Texture info (RMDLTexture), index: texture
+    RMDL_SECTION_TEXTURE_DATA,          // Texture pixel data, index: texture
+    RMDL_SECTION_BONES,                 // Model bones (rlBoneInfo[boneCount])
+    RMDL_SECTION_BIND_POSE,             // Model bind pose (rlTransform[boneCount])
+    RMDL_SECTION_ANIMATION,             // Animation info (RMDLAnimation), index: animation
+    RMDL_SECTION_ANIMATION_BONES,       // Animation bones (rlBoneInfo[boneCount]), index: animation
+    RMDL_SECTION_ANIMATION_POSES        // Animation frame poses (rlTransform[frameCount*boneCount]), index: animation
+} RMDLSectionType;
+
+// RMDL file header
+typedef struct RMDLHeader {
+    char id[4];                         // File identifier: "rMDL"
+    unsigned int version;               // File format version (RMDL_VERSION)
+    unsigned int sectionCount;          // Sections table size
+    unsigned int fileSize;              // File size in bytes
+} RMDLHeader;
+
+// RMDL section, table entry locating section data in file
+typedef struct RMDLSection {
+    unsigned int type;                  // Section type (RMDLSectionType)
+    unsigned int index;                 // Section element index (mesh, material, texture or animation)
+    unsigned int offset;                // Section data offset from file start (aligned to RMDL_SECTION_ALIGNMENT)
+    unsigned int size;                  // Section data size in bytes
+} RMDLSection;
+
+// RMDL model info
+typedef struct RMDLModel {
+    rlMatrix transform;                 // Local transform matrix
+    int meshCount;                      // Number of meshes
+    int materialCount;                  // Number of materials
+    int textureCount;                   // Number of textures (shared by materials maps)
+    int boneCount;                      // Number of bones
+} RMDLModel;
+
+// RMDL mesh info
+typedef struct RMDLMesh {
+    int vertexCount;                    // Number of vertices
+    int triangleCount;                  // Number of triangles
+    int boneCount;                      // Number of bones
+} RMDLMesh;
+
+// RMDL material map
+typedef struct RMDLMaterialMap {
+    int texture;                        // Texture index (or RMDL_TEXTURE_NONE, RMDL_TEXTURE_DEFAULT)
+    rlColor color;                      // Material map color
+    float value;                        // Material map value
+} RMDLMaterialMap;
+
+// RMDL material info, material uses default shader
+typedef struct RMDLMaterial {
+    RMDLMaterialMap maps[MAX_MATERIAL_MAPS]; // Material maps
+    float params[4];                    // Material generic parameters
+} RMDLMaterial;
+
+// RMDL texture info, pixel data is stored in texture data section
+typedef struct RMDLTexture {
+    int width;                          // Texture base width
+    int height;                         // Texture base height
+    int mipmaps;                        // Mipmap levels, 1 by default
+    int format;                         // Data format (PixelFormat type)
+} RMDLTexture;
+
+// RMDL animation info
+typedef struct RMDLAnimation {
+    int boneCount;                      // Number of bones
+    int frameCount;                     // Number of animation frames
+    char name[32];                      // Animation name
+} RMDLAnimation;
+
+// RMDL writer, sections data is referenced until file is saved
+typedef struct RMDLWriter {
+    RMDLSection *sections;              // Sections table
+    const void **sectionsData;          // Sections data
+    int sectionCount;                   // Sections count
+    int sectionCapacity;                // Sections allocated
+} RMDLWriter;
+
+// Model loaded asynchronously, CPU data is loaded by worker thread and GPU data is uploaded on GL thread
+struct rlModelAsync {
+    char *fileName;                     // Model file name
+    rlModel model;                      // Loaded model
+    rlImage *images;                    // Material textures images, waiting for upload (deferred textures)
+    int imageCount;                     // Material textures images count
+    int uploadCount;                    // Uploaded meshes and textures count (meshes first)
+    bool ready;                         // Model loaded and uploaded to GPU
+    bool cancelled;                     // Model unloaded before ready, released on upload (protected by async jobs mutex)
+    ModelLoadedCallback callback;       // Model loaded callback (optional)
+    void *userData;                     // Model loaded callback user data
+    rlModelAsync *next;                 // Next model in upload queue
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static rlInstanceBuffer instanceBufferDefault = { 0 };  // Default instance buffer, reused by rlDrawMeshInstanced()
+
+static rlModelAsync *modelUploadFirst = NULL;           // Async models upload queue first model (protected by async jobs mutex)
+static rlModelAsync *modelUploadLast = NULL;            // Async models upload queue last model (protected by async jobs mutex)
+static THREAD_LOCAL rlModelAsync *modelLoading = NULL;  // Async model loaded by current thread, GPU data is deferred
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+extern void UnloadInstanceBufferDefault(void);  // Unload default instance buffer (called by rlCloseWindow())
+extern void UnloadModelAsyncUploads(void);      // Unload async models waiting for upload (called by rlCloseWindow())
+static void SetInstanceBufferAttribs(rlInstanceBuffer buffer, rlShader shader, bool enable); // Attach/detach instance buffer attributes to current vertex array
+static rlModel LoadModelData(const char *fileName);     // Load model CPU data from file (meshes are not uploaded)
+static void LoadModelAsyncJob(void *data);              // Async job: load model CPU data and queue it for upload
+static void UnloadModelAsync(rlModelAsync *handle);     // Unload async model data uploaded so far and release handle
+static void SetModelAsyncTexture(rlModel *model, int index, Texture2D texture); // Replace async model placeholder texture in materials
+static Texture2D LoadModelTexture(rlImage image);       // Load material texture from image (deferred on async loading)
+static Texture2D LoadModelTextureFile(const char *fileName); // Load material texture from file (deferred on async loading)
+static void GetModelDirectoryPath(const char *fileName, char *dirPath); // Get model file directory path into buffer (MAX_FILEPATH_LENGTH)
+static const char *GetModelFilePath(char *filePath, const char *dirPath, const char *fileName); // Get file path relative to model directory into buffer (MAX_FILEPATH_LENGTH)
+static void GetMeshTriangle(rlMesh mesh, int index, rlVector3 *a, rlVector3 *b, rlVector3 *c);  // Get mesh triangle vertex positions (indexed or not)
+static float GetRayBoxDistance(rlVector3 origin, rlVector3 invDirection, rlVector3 min, rlVector3 max); // Get ray entry distance into box, FLT_MAX if no hit
+static bool GetRayTriangleDistance(rlVector3 origin, rlVector3 direction, const float *triangle, float *distance); // Get ray distance to triangle (Moller-Trumbore)
+static rlRay GetRayMeshSpace(rlRay ray, rlMatrix invTransform);      // Get ray transformed into mesh space (direction not normalized)
+static int GetRayBVHTriangle(rlMeshBVH bvh, rlRay meshRay, float *distance); // Get closest triangle hit by mesh space ray, -1 if no hit
+static rlRayCollision GetRayCollisionMeshHit(rlRay ray, const float *triangle, float distance, rlMatrix invTransform, bool mirrored); // Get world space collision info for mesh triangle hit
+static rlVector3 GetRayCollisionBoxNormal(rlBoundingBox box, rlVector3 point);  // Get box face normal at collision point
+static int LoadRayPacket(RayPacket *packet, const rlRay *rays, int count, int first, const rlMatrix *invTransform); // Load rays packet, returns valid rays count
+static void GetRayPacketTriangle(const RayPacket *packet, const float *triangle, int index, float *closest, int *closestIndex); // Update packet closest hits with triangle
+static void RayBatchSphereJob(void *data, int start, int end);       // Batch job: rays vs sphere (packets range)
+static void RayBatchBoxJob(void *data, int start, int end);          // Batch job: rays vs box (packets range)
+static void RayBatchTriangleJob(void *data, int start, int end);     // Batch job: rays vs triangle (packets range)
+static void RayBatchMeshJob(void *data, int start, int end);         // Batch job: rays vs mesh triangles (packets range)
+static void RayBatchMeshBVHJob(void *data, int start, int end);      // Batch job: rays vs mesh BVH (rays range)
+static void UpdateModelSkinning(rlModel model, const rlTransform *pose, int boneCount); // Update model meshes animated vertex data for pose (CPU skinning)
+static void SkinMeshJob(void *data, int start, int end);             // Skinning job: mesh vertices (vertex blocks range)
+static void UpdateModelBoneMatrices(rlModel model, const rlTransform *pose, int boneCount); // Update model meshes bone matrices for pose (GPU skinning)
+static float GetAnimationFrames(rlModelAnimation anim, float frame, int *frame0, int *frame1); // Get animation frames around fractional frame, returns interpolation amount
+static rlTransform GetTransformLerp(rlTransform t1, rlTransform t2, float amount); // Get interpolated transform (slerp rotation)
+static rlTransform GetAnimationTransform(rlModelAnimation anim, int frame0, int frame1, float amount, int bone); // Get animation bone transform between frames (compressed or not)
+static void GetAnimationPose(rlModelAnimation anim, int frame0, int frame1, float amount, rlTransform *pose); // Get animation pose between frames (compressed or not)
+static rlTransform GetAnimationKeysTransform(const rlAnimationKeys *keys, float frame, int bone); // Get compressed animation bone transform at fractional frame
+static int GetAnimationTrackKey(AnimationTrack track, const float *frames, float frame, float *amount); // Get track key before frame, returns key index
+static void QuantizeAnimationRotation(const float *rotation, unsigned short *quantized); // Quantize rotation (smallest three)
+static void DequantizeAnimationRotation(const unsigned short *quantized, float *rotation); // Dequantize rotation (smallest three)
+static void LerpAnimationKey(const float *key1, const float *key2, float amount, int components, float *result); // Interpolate keys values (rotations: shortest path slerp)
+static int ReduceAnimationTrack(const float *values, const float *decoded, int frameCount, int components, float tolerance, int *keyFrames); // Get track keyframes within tolerance, returns keys count
+static float GetAnimationKeyError(const float *value, const float *source, int components); // Get key value maximum component error
+static int GetAnimationKeysSize(const rlAnimationKeys *keys);        // Get compressed animation keyframes memory size (bytes)
+static void BuildPoseFromParentJoints(rlBoneInfo *bones, int boneCount, rlTransform *transforms); // Build pose from parent joints (parent relative to model space)
+static void BuildPoseToParentJoints(rlBoneInfo *bones, int boneCount, rlTransform *transforms); // Build pose to parent joints (model space to parent relative)
+static int AllocateAABBTreeNode(rlAABBTree *tree);                    // Get free tree node (grows nodes array)
+static void FreeAABBTreeNode(rlAABBTree *tree, int node);             // Free tree node
+static void InsertAABBTreeLeaf(rlAABBTree *tree, int leaf);           // Insert leaf node in tree
+static void RemoveAABBTreeLeaf(rlAABBTree *tree, int leaf);           // Remove leaf node from tree
+static int BalanceAABBTreeNode(rlAABBTree *tree, int node);           // Balance tree node with a rotation if required, returns subtree root
+static void UpdateAABBTreeAncestors(rlAABBTree *tree, int node);      // Balance and refit nodes from node to root
+static rlBoundingBox GetBoundingBoxUnion(rlBoundingBox box1, rlBoundingBox box2); // Get bounding box enclosing both boxes
+static float GetBoundingBoxArea(rlBoundingBox box);                   // Get bounding box surface area (half)
+static bool CheckCollisionBoxFrustum(rlBoundingBox box, const float *planes); // Check if box is inside or intersecting frustum planes
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static rlModel LoadOBJ(const char *fileName);     // Load OBJ mesh data
+static char *LoadFileTextOBJ(const char *fileName, const char *dirPath); // Load OBJ file text, material library path relative to OBJ directory
 #endif
 #if defined(SUPPORT_FILEFORMAT_IQM)
 static rlModel LoadIQM(const char *fileName);     // Load IQM mesh data
@@ -164,8 +457,19 @@ static rlModel LoadVOX(const char *filename);     // Load VOX mesh data
 static rlModel LoadM3D(const char *filename);     // Load M3D mesh data
 static rlModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+static rlModel LoadRMDL(const char *fileName);    // Load RMDL model data
+static rlModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount);  // Load RMDL animation data
+static bool IsDataValidRMDL(const unsigned char *fileData, int dataSize, const char *fileName); // Check RMDL file data header and sections table
+static bool IsCountValidRMDL(int count, unsigned int elementSize, int dataSize); // Check RMDL elements count fits in file data size
+static const void *GetSectionRMDL(const unsigned char *fileData, unsigned int type, unsigned int index, unsigned int size); // Get RMDL section data (NULL if not found or size is not matching)
+static void *LoadSectionRMDL(const unsigned char *fileData, unsigned int type, unsigned int index, unsigned int size); // Load RMDL section data copy (NULL if not found or size is not matching)
+static void **GetMeshArrayRMDL(rlMesh *mesh, unsigned int type, unsigned int *size); // Get mesh vertex array pointer and data size for RMDL section type
+static void AddSectionRMDL(RMDLWriter *writer, unsigned int type, unsigned int index, const void *data, unsigned int size); // Add section to RMDL writer (data is not copied)
+static bool SaveRMDL(RMDLWriter *writer, const char *fileName); // Save RMDL writer sections to file, writer is reset
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-static void ProcessMaterialsOBJ(rlMaterial *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static void ProcessMaterialsOBJ(rlMaterial *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *dirPath);  // Process obj materials
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1088,6 +1392,17 @@ void rlDrawGrid(int slices, float spacing)
 
 // Load model from files (mesh and material)
 rlModel rlLoadModel(const char *fileName)
+{
+    rlModel model = LoadModelData(fileName);
+
+    // Upload vertex data to GPU (static meshes)
+    for (int i = 0; i < model.meshCount; i++) rlUploadMesh(&model.meshes[i], false);
+
+    return model;
+}
+
+// Load model CPU data from file (meshes are not uploaded)
+static rlModel LoadModelData(const char *fileName)
 {
     rlModel model = { 0 };
 
@@ -1106,16 +1421,19 @@ rlModel rlLoadModel(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_M3D)
     if (rlIsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
 #endif
+    bool transformLoaded = false;   // Model transform loaded from file (RMDL)
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (rlIsFileExtension(fileName, ".rmdl"))
+    {
+        model = LoadRMDL(fileName);
+        transformLoaded = (model.meshCount > 0);
+    }
+#endif
 
     // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    if (!transformLoaded) model.transform = MatrixIdentity();
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
-    {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) rlUploadMesh(&model.meshes[i], false);
-    }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
 
     if (model.materialCount == 0)
     {
@@ -1131,6 +1449,142 @@ rlModel rlLoadModel(const char *fileName)
     return model;
 }
 
+// Async job: load model CPU data and queue it for upload on GL thread
+static void LoadModelAsyncJob(void *data)
+{
+    rlModelAsync *handle = (rlModelAsync *)data;
+
+    LockAsyncJobs();
+    bool cancelled = handle->cancelled;
+    UnlockAsyncJobs();
+
+    // NOTE: Model unloaded before loading started is not loaded, handle is queued anyway to be released on GL thread
+    if (!cancelled)
+    {
+        modelLoading = handle;
+        handle->model = LoadModelData(handle->fileName);
+        modelLoading = NULL;
+    }
+
+    LockAsyncJobs();
+    if (modelUploadLast != NULL) modelUploadLast->next = handle;
+    else modelUploadFirst = handle;
+    modelUploadLast = handle;
+    UnlockAsyncJobs();
+}
+
+// Unload async model data uploaded so far (meshes and materials textures) and release handle
+// NOTE: Model was never returned to user, so materials textures are unloaded too
+static void UnloadModelAsync(rlModelAsync *handle)
+{
+    rlModel *model = &handle->model;
+
+    // Images not uploaded yet are unloaded, placeholder textures are replaced by default texture
+    for (int i = 0; i < handle->imageCount; i++)
+    {
+        if ((model->meshCount + i) >= handle->uploadCount)
+        {
+            rlUnloadImage(handle->images[i]);
+            SetModelAsyncTexture(model, i, (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 });
+        }
+    }
+
+    for (int i = 0; i < model->materialCount; i++)
+    {
+        rlUnloadMaterial(model->materials[i]);
+        model->materials[i].maps = NULL;
+    }
+
+    rlUnloadModel(*model);
+
+    RL_FREE(handle->images);
+    RL_FREE(handle->fileName);
+    RL_FREE(handle);
+}
+
+// Replace async model placeholder texture (deferred texture index) in materials
+static void SetModelAsyncTexture(rlModel *model, int index, Texture2D texture)
+{
+    for (int m = 0; m < model->materialCount; m++)
+    {
+        for (int i = 0; (model->materials[m].maps != NULL) && (i < MAX_MATERIAL_MAPS); i++)
+        {
+            if (model->materials[m].maps[i].texture.id == (MODEL_ASYNC_TEXTURE_ID + (unsigned int)index)) model->materials[m].maps[i].texture = texture;
+        }
+    }
+}
+
+// Load material texture from image, texture upload is deferred when model is loaded asynchronously:
+// image copy is kept for upload and a placeholder texture is returned
+static Texture2D LoadModelTexture(rlImage image)
+{
+    if (modelLoading == NULL) return rlLoadTextureFromImage(image);
+
+    Texture2D texture = { 0 };
+
+    if (image.data != NULL)
+    {
+        rlModelAsync *handle = modelLoading;
+
+        handle->images = (rlImage *)RL_REALLOC(handle->images, (handle->imageCount + 1)*sizeof(rlImage));
+        handle->images[handle->imageCount] = rlImageCopy(image);
+
+        texture.id = MODEL_ASYNC_TEXTURE_ID + (unsigned int)handle->imageCount;
+        texture.width = image.width;
+        texture.height = image.height;
+        texture.mipmaps = image.mipmaps;
+        texture.format = image.format;
+
+        handle->imageCount++;
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    return texture;
+}
+
+// Load material texture from file, texture upload is deferred when model is loaded asynchronously
+static Texture2D LoadModelTextureFile(const char *fileName)
+{
+    if (modelLoading == NULL) return LoadTexture(fileName);
+
+    rlImage image = rlLoadImage(fileName);
+    Texture2D texture = LoadModelTexture(image);
+    rlUnloadImage(image);
+
+    return texture;
+}
+
+// Get model file directory path into provided buffer (MAX_FILEPATH_LENGTH)
+// NOTE: Used by loaders instead of rlGetDirectoryPath(), its static buffer is not safe on async loading
+static void GetModelDirectoryPath(const char *fileName, char *dirPath)
+{
+    const char *lastSlash = NULL;
+    for (const char *c = fileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) lastSlash = c;
+
+    if (lastSlash == NULL) strcpy(dirPath, ".");
+    else if (lastSlash == fileName) strcpy(dirPath, "/");
+    else
+    {
+        int length = (int)(lastSlash - fileName);
+        if (length > (MAX_FILEPATH_LENGTH - 1)) length = MAX_FILEPATH_LENGTH - 1;
+
+        memcpy(dirPath, fileName, length);
+        dirPath[length] = '\0';
+    }
+}
+
+// Get file path relative to model directory into provided buffer (MAX_FILEPATH_LENGTH), absolute paths are kept
+// NOTE: Used by loaders instead of rlTextFormat(), its static buffers are not safe on async loading
+static const char *GetModelFilePath(char *filePath, const char *dirPath, const char *fileName)
+{
+    bool absolute = (fileName[0] == '/') || (fileName[0] == '\\') || ((fileName[0] != '\0') && (fileName[1] == ':'));
+
+    if ((dirPath == NULL) || absolute) snprintf(filePath, MAX_FILEPATH_LENGTH, "%s", fileName);
+    else snprintf(filePath, MAX_FILEPATH_LENGTH, "%s/%s", dirPath, fileName);
+
+    return filePath;
+}
+
 // Load model from generated mesh
 // WARNING: A shallow copy of mesh is generated, passed by value,
 // as long as struct contains pointers to data and some values, we get a copy
@@ -1232,6 +1686,292 @@ rlBoundingBox rlGetModelBoundingBox(rlModel model)
     return bounds;
 }
 
+// Export model data to file (.rmdl), binary format loaded with no parsing
+// NOTE: Textures pixel data is read back from GPU, materials shaders are not exported (default shader is used)
+bool rlExportModel(rlModel model, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (rlIsFileExtension(fileName, ".rmdl"))
+    {
+        RMDLWriter writer = { 0 };
+        RMDLModel info = { model.transform, model.meshCount, model.materialCount, 0, model.boneCount };
+
+        RMDLMesh *meshes = (RMDLMesh *)RL_CALLOC(model.meshCount, sizeof(RMDLMesh));
+        RMDLMaterial *materials = (RMDLMaterial *)RL_CALLOC(model.materialCount, sizeof(RMDLMaterial));
+        unsigned int *textureIds = (unsigned int *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS, sizeof(unsigned int));
+        rlImage *images = (rlImage *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS, sizeof(rlImage));
+        RMDLTexture *textures = (RMDLTexture *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS, sizeof(RMDLTexture));
+
+        AddSectionRMDL(&writer, RMDL_SECTION_MODEL, 0, &info, sizeof(RMDLModel));
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            rlMesh mesh = model.meshes[i];
+            meshes[i] = (RMDLMesh){ mesh.vertexCount, mesh.triangleCount, mesh.boneCount };
+            AddSectionRMDL(&writer, RMDL_SECTION_MESH, i, &meshes[i], sizeof(RMDLMesh));
+
+            for (unsigned int type = RMDL_SECTION_MESH_VERTICES; type <= RMDL_SECTION_MESH_BONE_WEIGHTS; type++)
+            {
+                unsigned int size = 0;
+                void **array = GetMeshArrayRMDL(&model.meshes[i], type, &size);
+                AddSectionRMDL(&writer, type, i, *array, size);
+            }
+        }
+
+        AddSectionRMDL(&writer, RMDL_SECTION_MESH_MATERIAL, 0, model.meshMaterial, model.meshCount*sizeof(int));
+
+        // Materials maps textures are shared, every texture is exported once
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            for (int m = 0; m < 4; m++) materials[i].params[m] = model.materials[i].params[m];
+
+            for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+            {
+                rlMaterialMap map = (model.materials[i].maps != NULL)? model.materials[i].maps[m] : (rlMaterialMap){ 0 };
+
+                materials[i].maps[m] = (RMDLMaterialMap){ RMDL_TEXTURE_NONE, map.color, map.value };
+
+                if (map.texture.id == rlGetTextureIdDefault()) materials[i].maps[m].texture = RMDL_TEXTURE_DEFAULT;
+                else if (map.texture.id > 0)
+                {
+                    int texture = 0;
+                    while ((texture < info.textureCount) && (textureIds[texture] != map.texture.id)) texture++;
+
+                    if (texture == info.textureCount)
+                    {
+                        images[texture] = rlLoadImageFromTexture(map.texture);
+                        if (images[texture].data == NULL) continue;
+
+                        textureIds[texture] = map.texture.id;
+                        textures[texture] = (RMDLTexture){ images[texture].width, images[texture].height, images[texture].mipmaps, images[texture].format };
+                        AddSectionRMDL(&writer, RMDL_SECTION_TEXTURE, texture, &textures[texture], sizeof(RMDLTexture));
+                        AddSectionRMDL(&writer, RMDL_SECTION_TEXTURE_DATA, texture, images[texture].data, GetPixelDataSize(images[texture].width, images[texture].height, images[texture].format));
+                        info.textureCount++;
+                    }
+
+                    materials[i].maps[m].texture = texture;
+                }
+            }
+
+            AddSectionRMDL(&writer, RMDL_SECTION_MATERIAL, i, &materials[i], sizeof(RMDLMaterial));
+        }
+
+        AddSectionRMDL(&writer, RMDL_SECTION_BONES, 0, model.bones, model.boneCount*sizeof(rlBoneInfo));
+        AddSectionRMDL(&writer, RMDL_SECTION_BIND_POSE, 0, model.bindPose, model.boneCount*sizeof(rlTransform));
+
+        success = SaveRMDL(&writer, fileName);
+
+        for (int i = 0; i < info.textureCount; i++) rlUnloadImage(images[i]);
+        RL_FREE(meshes);
+        RL_FREE(materials);
+        RL_FREE(textureIds);
+        RL_FREE(images);
+        RL_FREE(textures);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "MODEL: [%s] Model exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to export model", fileName);
+
+    return success;
+}
+
+// Export model animations to file (.rmdl), binary format loaded with no parsing
+// NOTE: Compressed animations are exported as sampled frame poses
+bool rlExportModelAnimations(rlModelAnimation *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if ((animations != NULL) && rlIsFileExtension(fileName, ".rmdl"))
+    {
+        RMDLWriter writer = { 0 };
+        RMDLAnimation *infos = (RMDLAnimation *)RL_CALLOC(animCount, sizeof(RMDLAnimation));
+        rlTransform **poses = (rlTransform **)RL_CALLOC(animCount, sizeof(rlTransform *));
+
+        for (int i = 0; i < animCount; i++)
+        {
+            rlModelAnimation anim = animations[i];
+
+            infos[i].boneCount = anim.boneCount;
+            infos[i].frameCount = anim.frameCount;
+            memcpy(infos[i].name, anim.name, sizeof(infos[i].name));
+
+            // Frame poses are stored contiguous, by frame
+            poses[i] = (rlTransform *)RL_MALLOC(anim.frameCount*anim.boneCount*sizeof(rlTransform));
+
+            for (int frame = 0; frame < anim.frameCount; frame++)
+            {
+                if (anim.framePoses != NULL) memcpy(poses[i] + frame*anim.boneCount, anim.framePoses[frame], anim.boneCount*sizeof(rlTransform));
+                else rlGetModelAnimationPose(anim, (float)frame, poses[i] + frame*anim.boneCount);
+            }
+
+            AddSectionRMDL(&writer, RMDL_SECTION_ANIMATION, i, &infos[i], sizeof(RMDLAnimation));
+            AddSectionRMDL(&writer, RMDL_SECTION_ANIMATION_BONES, i, anim.bones, anim.boneCount*sizeof(rlBoneInfo));
+            AddSectionRMDL(&writer, RMDL_SECTION_ANIMATION_POSES, i, poses[i], anim.frameCount*anim.boneCount*sizeof(rlTransform));
+        }
+
+        success = SaveRMDL(&writer, fileName);
+
+        for (int i = 0; i < animCount; i++) RL_FREE(poses[i]);
+        RL_FREE(poses);
+        RL_FREE(infos);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "ANIMATION: [%s] Model animations exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "ANIMATION: [%s] Failed to export model animations", fileName);
+
+    return success;
+}
+
+// Load model on a worker thread, CPU data (meshes, animations, textures images) is loaded asynchronously
+// and GPU data is uploaded by rlUpdateModelAsyncUploads(), callback is called once model is ready
+// NOTE: Loaders do not use functions with internal static buffers nor change working directory,
+// handles of models not ready yet are released on rlCloseWindow()
+rlModelAsync *rlLoadModelAsync(const char *fileName, ModelLoadedCallback callback, void *userData)
+{
+    if (fileName == NULL) return NULL;
+
+    rlModelAsync *handle = (rlModelAsync *)RL_CALLOC(1, sizeof(rlModelAsync));
+    handle->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(handle->fileName, fileName);
+    handle->callback = callback;
+    handle->userData = userData;
+
+    RunAsyncJob(LoadModelAsyncJob, handle);
+
+    return handle;
+}
+
+// Check if async model is loaded and uploaded to GPU
+bool rlIsModelAsyncReady(rlModelAsync *handle)
+{
+    return ((handle != NULL) && handle->ready);
+}
+
+// Get async loaded model, handle is released
+// NOTE: Models loaded with callback are passed to callback, handle is released after it
+rlModel rlGetModelAsync(rlModelAsync *handle)
+{
+    rlModel model = { 0 };
+
+    if (rlIsModelAsyncReady(handle))
+    {
+        model = handle->model;
+
+        RL_FREE(handle->fileName);
+        RL_FREE(handle);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: Async model is not ready");
+
+    return model;
+}
+
+// Unload async model, handle is released
+// NOTE: Model not ready yet is unloaded once loaded by rlUpdateModelAsyncUploads() (loading is skipped if not started),
+// handles of models loaded with callback are released after callback, they can only be unloaded before it
+void rlUnloadModelAsync(rlModelAsync *handle)
+{
+    if (handle == NULL) return;
+
+    if (handle->ready) UnloadModelAsync(handle);
+    else
+    {
+        LockAsyncJobs();
+        handle->cancelled = true;
+        UnlockAsyncJobs();
+    }
+}
+
+// Upload loaded models meshes and textures to GPU, models are uploaded in load completion order
+// NOTE: Uploads are limited to maxUploads meshes/textures per call to bound frame time
+void rlUpdateModelAsyncUploads(int maxUploads)
+{
+    int uploads = 0;
+
+    while (uploads < maxUploads)
+    {
+        LockAsyncJobs();
+        rlModelAsync *handle = modelUploadFirst;
+        bool cancelled = (handle != NULL) && handle->cancelled;
+        if (cancelled)
+        {
+            modelUploadFirst = handle->next;
+            if (modelUploadFirst == NULL) modelUploadLast = NULL;
+        }
+        UnlockAsyncJobs();
+
+        if (handle == NULL) break;
+
+        // Model unloaded before ready, data uploaded so far is unloaded
+        if (cancelled)
+        {
+            UnloadModelAsync(handle);
+            continue;
+        }
+
+        rlModel *model = &handle->model;
+
+        for (; (handle->uploadCount < (model->meshCount + handle->imageCount)) && (uploads < maxUploads); handle->uploadCount++, uploads++)
+        {
+            if (handle->uploadCount < model->meshCount) rlUploadMesh(&model->meshes[handle->uploadCount], false);
+            else
+            {
+                // Upload deferred texture and replace placeholder texture in materials
+                int index = handle->uploadCount - model->meshCount;
+                Texture2D texture = rlLoadTextureFromImage(handle->images[index]);
+                rlUnloadImage(handle->images[index]);
+
+                SetModelAsyncTexture(model, index, texture);
+            }
+        }
+
+        if (handle->uploadCount < (model->meshCount + handle->imageCount)) break;
+
+        // Model uploaded, remove it from upload queue
+        LockAsyncJobs();
+        modelUploadFirst = handle->next;
+        if (modelUploadFirst == NULL) modelUploadLast = NULL;
+        UnlockAsyncJobs();
+
+        RL_FREE(handle->images);
+        handle->images = NULL;
+        handle->next = NULL;
+        handle->ready = true;
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] Async model loaded successfully", handle->fileName);
+
+        if (handle->callback != NULL)
+        {
+            handle->callback(handle->model, handle->userData);
+
+            RL_FREE(handle->fileName);
+            RL_FREE(handle);
+        }
+    }
+}
+
+// Unload async models waiting for upload, their handles are released
+// NOTE: Called by rlCloseWindow() once job system is closed, so no model is loading
+void UnloadModelAsyncUploads(void)
+{
+    LockAsyncJobs();
+    rlModelAsync *handle = modelUploadFirst;
+    modelUploadFirst = NULL;
+    modelUploadLast = NULL;
+    UnlockAsyncJobs();
+
+    while (handle != NULL)
+    {
+        rlModelAsync *next = handle->next;
+        UnloadModelAsync(handle);
+        handle = next;
+    }
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void rlUploadMesh(rlMesh *mesh, bool dynamic)
 {
@@ -1651,12 +2391,33 @@ void rlDrawMesh(rlMesh mesh, rlMaterial material, rlMatrix transform)
 }
 
 // Draw multiple mesh instances with material and different transforms
+// NOTE: Transforms are uploaded to default instance buffer, reused (and grown if required) by next calls,
+// buffer storage is orphaned before every upload, previous draws reading it do not stall the update
 void rlDrawMeshInstanced(rlMesh mesh, rlMaterial material, const rlMatrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if (instances > instanceBufferDefault.capacity)
+    {
+        int capacity = (instanceBufferDefault.capacity > 0)? instanceBufferDefault.capacity : DEFAULT_INSTANCE_BUFFER_CAPACITY;
+        while (capacity < instances) capacity *= 2;
+
+        rlUnloadInstanceBuffer(instanceBufferDefault);
+        instanceBufferDefault = rlLoadInstanceBuffer(capacity, false);
+    }
+
+    rlOrphanVertexBuffer(instanceBufferDefault.transformsVboId, instanceBufferDefault.capacity*sizeof(float16));
+    rlUpdateInstanceTransforms(instanceBufferDefault, transforms, 0, instances);
+    rlDrawMeshInstancedBuffer(mesh, material, instanceBufferDefault, instances);
+#endif
+}
+
+// Draw mesh instances stored in instance buffer, first instances are drawn
+// NOTE: Instance buffer attributes are attached to mesh VAO for the draw and detached after it
+void rlDrawMeshInstancedBuffer(rlMesh mesh, rlMaterial material, rlInstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instances > buffer.capacity) instances = buffer.capacity;
+    if (instances <= 0) return;
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1703,30 +2464,9 @@ void rlDrawMeshInstanced(rlMesh mesh, rlMaterial material, const rlMatrix *trans
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instance buffer attributes
     rlEnableVertexArray(mesh.vaoId);
-
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
-
-    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
-    {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(rlMatrix), i*sizeof(rlVector4));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
-    }
-
-    rlDisableVertexBuffer();
+    SetInstanceBufferAttribs(buffer, material.shader, true);
     rlDisableVertexArray();
 
     // Accumulate internal matrix transform (push/pop) and view matrix
@@ -1881,6 +2621,10 @@ void rlDrawMeshInstanced(rlMesh mesh, rlMaterial material, const rlMatrix *trans
         }
     }
 
+    // Detach instance buffer attributes, mesh VAO could be used by non-instanced draws
+    rlEnableVertexArray(mesh.vaoId);
+    SetInstanceBufferAttribs(buffer, material.shader, false);
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1888,36 +2632,136 @@ void rlDrawMeshInstanced(rlMesh mesh, rlMaterial material, const rlMatrix *trans
 
     // Disable shader program
     rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
 #endif
 }
 
-// Unload mesh from memory (RAM and VRAM)
-void rlUnloadMesh(rlMesh mesh)
+// Load instance buffer for instanced mesh drawing
+// NOTE: Instances transforms buffer always created, colors buffer is optional
+rlInstanceBuffer rlLoadInstanceBuffer(int capacity, bool colors)
 {
-    // Unload rlgl mesh vboId data
-    rlUnloadVertexArray(mesh.vaoId);
+    rlInstanceBuffer buffer = { 0 };
 
-    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
-    RL_FREE(mesh.vboId);
+    if (capacity <= 0) return buffer;
 
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
+    buffer.transformsVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(float16), true);
+    if (colors) buffer.colorsVboId = rlLoadVertexBuffer(NULL, capacity*4*sizeof(unsigned char), true);
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
-    RL_FREE(mesh.boneMatrices);
-}
+    if (buffer.transformsVboId > 0)
+    {
+        buffer.capacity = capacity;
+        TRACELOG(LOG_INFO, "VBO: [ID %i] Instance buffer loaded successfully (%i instances)", buffer.transformsVboId, capacity);
+    }
+    else TRACELOG(LOG_WARNING, "VBO: Failed to load instance buffer");
+
+    return buffer;
+}
+
+// Add custom per-instance attribute to instance buffer, returns attribute index (-1 on failure)
+// NOTE: Attribute data is float (1..4 components), bound to shader attribute location (rlGetShaderLocationAttrib())
+int rlAddInstanceBufferAttribute(rlInstanceBuffer *buffer, int locIndex, int components)
+{
+    int index = -1;
+
+    if ((buffer->capacity > 0) && (locIndex >= 0) && (components >= 1) && (components <= 4) && (buffer->attribCount < MAX_INSTANCE_ATTRIBUTES))
+    {
+        if (buffer->attribVboId == NULL)
+        {
+            buffer->attribVboId = (unsigned int *)RL_CALLOC(MAX_INSTANCE_ATTRIBUTES, sizeof(unsigned int));
+            buffer->attribComponents = (int *)RL_CALLOC(MAX_INSTANCE_ATTRIBUTES, sizeof(int));
+            buffer->attribLocs = (int *)RL_CALLOC(MAX_INSTANCE_ATTRIBUTES, sizeof(int));
+        }
+
+        index = buffer->attribCount;
+        buffer->attribVboId[index] = rlLoadVertexBuffer(NULL, buffer->capacity*components*sizeof(float), true);
+        buffer->attribComponents[index] = components;
+        buffer->attribLocs[index] = locIndex;
+        buffer->attribCount++;
+    }
+    else TRACELOG(LOG_WARNING, "VBO: Failed to add instance buffer attribute");
+
+    return index;
+}
+
+// Update instances transforms in instance buffer, starting at instance offset
+void rlUpdateInstanceTransforms(rlInstanceBuffer buffer, const rlMatrix *transforms, int offset, int count)
+{
+    if ((offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity)) return;
+
+    // NOTE: rlMatrix memory layout is row-major, transforms are converted in chunks
+    // to column-major float16 arrays (as expected by shader) without allocations
+    float16 chunk[INSTANCE_TRANSFORMS_CHUNK];
+
+    for (int i = 0; i < count; i += INSTANCE_TRANSFORMS_CHUNK)
+    {
+        int chunkCount = ((count - i) < INSTANCE_TRANSFORMS_CHUNK)? (count - i) : INSTANCE_TRANSFORMS_CHUNK;
+
+        for (int k = 0; k < chunkCount; k++) chunk[k] = MatrixToFloatV(transforms[i + k]);
+
+        rlUpdateVertexBuffer(buffer.transformsVboId, chunk, chunkCount*sizeof(float16), (offset + i)*sizeof(float16));
+    }
+}
+
+// Update instances colors in instance buffer, starting at instance offset
+void rlUpdateInstanceColors(rlInstanceBuffer buffer, const rlColor *colors, int offset, int count)
+{
+    if ((buffer.colorsVboId == 0) || (offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity)) return;
+
+    rlUpdateVertexBuffer(buffer.colorsVboId, colors, count*4*sizeof(unsigned char), offset*4*sizeof(unsigned char));
+}
+
+// Update instances custom attribute data in instance buffer, starting at instance offset
+void rlUpdateInstanceAttribute(rlInstanceBuffer buffer, int index, const float *data, int offset, int count)
+{
+    if ((index < 0) || (index >= buffer.attribCount) || (offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity)) return;
+
+    int components = buffer.attribComponents[index];
+    rlUpdateVertexBuffer(buffer.attribVboId[index], data, count*components*sizeof(float), offset*components*sizeof(float));
+}
+
+// Unload instance buffer from GPU memory (VRAM)
+void rlUnloadInstanceBuffer(rlInstanceBuffer buffer)
+{
+    rlUnloadVertexBuffer(buffer.transformsVboId);
+    rlUnloadVertexBuffer(buffer.colorsVboId);
+
+    for (int i = 0; i < buffer.attribCount; i++) rlUnloadVertexBuffer(buffer.attribVboId[i]);
+
+    RL_FREE(buffer.attribVboId);
+    RL_FREE(buffer.attribComponents);
+    RL_FREE(buffer.attribLocs);
+}
+
+// Unload default instance buffer (used by rlDrawMeshInstanced())
+// NOTE: Called by rlCloseWindow(), GPU buffer is not valid on a new OpenGL context
+void UnloadInstanceBufferDefault(void)
+{
+    rlUnloadInstanceBuffer(instanceBufferDefault);
+    instanceBufferDefault = (rlInstanceBuffer){ 0 };
+}
+
+// Unload mesh from memory (RAM and VRAM)
+void rlUnloadMesh(rlMesh mesh)
+{
+    // Unload rlgl mesh vboId data
+    rlUnloadVertexArray(mesh.vaoId);
+
+    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
+    RL_FREE(mesh.vboId);
+
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
+
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+}
 
 // Export mesh data to file
 bool rlExportMesh(rlMesh mesh, const char *fileName)
@@ -2098,8 +2942,11 @@ bool rlExportMeshAsCode(rlMesh mesh, const char *fileName)
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 // Process obj materials
-static void ProcessMaterialsOBJ(rlMaterial *materials, tinyobj_material_t *mats, int materialCount)
+// NOTE: Textures paths are relative to dirPath (if provided)
+static void ProcessMaterialsOBJ(rlMaterial *materials, tinyobj_material_t *mats, int materialCount, const char *dirPath)
 {
+    char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+
     // Init model mats
     for (int m = 0; m < materialCount; m++)
     {
@@ -2113,21 +2960,21 @@ static void ProcessMaterialsOBJ(rlMaterial *materials, tinyobj_material_t *mats,
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadModelTextureFile(GetModelFilePath(texPath, dirPath, mats[m].diffuse_texname));  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (rlColor){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadModelTextureFile(GetModelFilePath(texPath, dirPath, mats[m].specular_texname));  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (rlColor){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTextureFile(GetModelFilePath(texPath, dirPath, mats[m].bump_texname));  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (rlColor){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadModelTextureFile(GetModelFilePath(texPath, dirPath, mats[m].displacement_texname));  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -2149,7 +2996,7 @@ rlMaterial *rlLoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = RL_MALLOC(count*sizeof(rlMaterial));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -2240,6 +3087,16 @@ rlModelAnimation *rlLoadModelAnimations(const char *fileName, int *animCount)
 #if defined(SUPPORT_FILEFORMAT_GLTF)
     if (rlIsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (rlIsFileExtension(fileName, ".rmdl")) animations = LoadModelAnimationsRMDL(fileName, animCount);
+#endif
+
+#if defined(SUPPORT_ANIMATION_COMPRESSION)
+    if (animations != NULL)
+    {
+        for (int i = 0; i < *animCount; i++) rlCompressModelAnimation(&animations[i], ANIMATION_COMPRESSION_TOLERANCE);
+    }
+#endif
 
     return animations;
 }
@@ -2252,142 +3109,119 @@ void rlUpdateModelAnimation(rlModel model, rlModelAnimation anim, int frame)
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int m = 0; m < model.meshCount; m++)
-        {
-            rlMesh mesh = model.meshes[m];
+        UpdateModelSkinning(model, anim.framePoses[frame], anim.boneCount);
+    }
+    else if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.keys != NULL))
+    {
+        rlTransform *pose = (rlTransform *)RL_MALLOC(anim.boneCount*sizeof(rlTransform));
 
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
-            {
-                TRACELOG(LOG_WARNING, "MODEL: rlUpdateModelAnimation(): rlMesh %i has no connection to bones", m);
-                continue;
-            }
+        rlGetModelAnimationPose(anim, (float)frame, pose);
+        UpdateModelSkinning(model, pose, anim.boneCount);
 
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            rlVector3 animVertex = { 0 };
-            rlVector3 animNormal = { 0 };
+        RL_FREE(pose);
+    }
+}
 
-            rlVector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // rlVector3 inScale = { 0 };
+void rlUpdateModelAnimationBoneMatrices(rlModel model, rlModelAnimation anim, int frame)
+{
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    {
+        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-            rlVector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            rlVector3 outScale = { 0 };
+        UpdateModelBoneMatrices(model, anim.framePoses[frame], anim.boneCount);
+    }
+    else if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.keys != NULL))
+    {
+        rlTransform *pose = (rlTransform *)RL_MALLOC(anim.boneCount*sizeof(rlTransform));
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+        rlGetModelAnimationPose(anim, (float)frame, pose);
+        UpdateModelBoneMatrices(model, pose, anim.boneCount);
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-            {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+        RL_FREE(pose);
+    }
+}
 
-                if (mesh.animNormals != NULL)
-                {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
+// Get animation pose at a fractional frame, interpolating between closest frames
+void rlGetModelAnimationPose(rlModelAnimation anim, float frame, rlTransform *pose)
+{
+    if ((pose == NULL) || (anim.frameCount <= 0) || ((anim.framePoses == NULL) && (anim.keys == NULL))) return;
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (rlVector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (rlVector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
-            }
+    int frame0 = 0;
+    int frame1 = 0;
+    float amount = GetAnimationFrames(anim, frame, &frame0, &frame1);
 
-            // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
-            {
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-            }
-        }
-    }
+    GetAnimationPose(anim, frame0, frame1, amount, pose);
 }
 
-void rlUpdateModelAnimationBoneMatrices(rlModel model, rlModelAnimation anim, int frame)
+// Blend animation layers into pose, layers are applied in order over model bind pose
+// NOTE: Layers are blended on parent relative transforms, every layer interpolates current pose towards
+// its sampled pose by weight*boneMask[bone], masked bones follow their parents, a full weight layer overrides
+// previous layers, partial weights crossfade between them. Resulting pose is composed back to model space
+void rlBlendModelAnimationLayers(rlModel model, const rlAnimationLayer *layers, int layerCount, rlTransform *pose)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    if ((pose == NULL) || (model.bindPose == NULL)) return;
+
+    for (int i = 0; i < model.boneCount; i++) pose[i] = model.bindPose[i];
+    BuildPoseToParentJoints(model.bones, model.boneCount, pose);
+
+    for (int l = 0; l < layerCount; l++)
     {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;    
-    
-        for (int i = 0; i < model.meshCount; i++)
+        rlModelAnimation anim = layers[l].animation;
+
+        if ((layers[l].weight <= 0.0f) || (anim.frameCount <= 0) || ((anim.framePoses == NULL) && (anim.keys == NULL))) continue;
+
+        int frame0 = 0;
+        int frame1 = 0;
+        float amount = GetAnimationFrames(anim, layers[l].frame, &frame0, &frame1);
+        int boneCount = (anim.boneCount < model.boneCount)? anim.boneCount : model.boneCount;
+
+        // Sample layer pose as parent relative transforms, model space poses are converted
+        // NOTE: Parent relative keys are sampled directly, no need to compose them with parents
+        rlTransform *samples = (rlTransform *)RL_MALLOC(anim.boneCount*sizeof(rlTransform));
+
+        for (int i = 0; i < anim.boneCount; i++) samples[i] = GetAnimationTransform(anim, frame0, frame1, amount, i);
+        if ((anim.keys == NULL) || !anim.keys->local) BuildPoseToParentJoints(anim.bones, anim.boneCount, samples);
+
+        for (int i = 0; i < boneCount; i++)
         {
-            if (model.meshes[i].boneMatrices)
-            {
-                assert(model.meshes[i].boneCount == anim.boneCount);
-              
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    rlVector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    rlVector3 inScale = model.bindPose[boneId].scale;
-                    
-                    rlVector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    rlVector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    rlVector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
-                    Quaternion invRotation = QuaternionInvert(inRotation);
-                    rlVector3 invScale = Vector3Divide((rlVector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    rlVector3 boneTranslation = Vector3Add(
-                        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation); 
-                    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-                    rlVector3 boneScale = Vector3Multiply(outScale, invScale);
-                    
-                    rlMatrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                        QuaternionToMatrix(boneRotation),
-                        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
-                    
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
-            }
+            float weight = layers[l].weight;
+            if (layers[l].boneMask != NULL) weight *= layers[l].boneMask[i];
+            if (weight <= 0.0f) continue;
+
+            pose[i] = GetTransformLerp(pose[i], samples[i], weight);
         }
+
+        RL_FREE(samples);
     }
+
+    BuildPoseFromParentJoints(model.bones, model.boneCount, pose);
+}
+
+// Update model animated vertex data (positions and normals) for blended animation layers
+// NOTE: Layers are blended on bones, vertex data is skinned once for resulting pose
+void rlUpdateModelAnimationLayers(rlModel model, const rlAnimationLayer *layers, int layerCount)
+{
+    if ((model.boneCount <= 0) || (model.bindPose == NULL)) return;
+
+    rlTransform *pose = (rlTransform *)RL_MALLOC(model.boneCount*sizeof(rlTransform));
+
+    rlBlendModelAnimationLayers(model, layers, layerCount, pose);
+    UpdateModelSkinning(model, pose, model.boneCount);
+
+    RL_FREE(pose);
+}
+
+// Update model meshes bone matrices for blended animation layers
+void rlUpdateModelAnimationLayersBoneMatrices(rlModel model, const rlAnimationLayer *layers, int layerCount)
+{
+    if ((model.boneCount <= 0) || (model.bindPose == NULL)) return;
+
+    rlTransform *pose = (rlTransform *)RL_MALLOC(model.boneCount*sizeof(rlTransform));
+
+    rlBlendModelAnimationLayers(model, layers, layerCount, pose);
+    UpdateModelBoneMatrices(model, pose, model.boneCount);
+
+    RL_FREE(pose);
 }
 
 // Unload animation array data
@@ -2400,7 +3234,20 @@ void rlUnloadModelAnimations(rlModelAnimation *animations, int animCount)
 // Unload animation data
 void rlUnloadModelAnimation(rlModelAnimation anim)
 {
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    }
+
+    if (anim.keys != NULL)
+    {
+        RL_FREE(anim.keys->tracks);
+        RL_FREE(anim.keys->vectorFrames);
+        RL_FREE(anim.keys->vectors);
+        RL_FREE(anim.keys->rotationFrames);
+        RL_FREE(anim.keys->rotations);
+        RL_FREE(anim.keys);
+    }
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
@@ -2424,6 +3271,114 @@ bool rlIsModelAnimationValid(rlModel model, rlModelAnimation anim)
     return result;
 }
 
+// Compress animation keyframes, framePoses are replaced by compressed keys
+// NOTE: Constant tracks are stored as one key and frames that can be interpolated
+// from surrounding keys within tolerance are removed, rotations are quantized
+// WARNING: anim->framePoses is freed and set to NULL, poses must be read with rlGetModelAnimationPose()
+void rlCompressModelAnimation(rlModelAnimation *anim, float tolerance)
+{
+    if ((anim == NULL) || (anim->framePoses == NULL) || (anim->keys != NULL) || (anim->frameCount <= 0) || (anim->boneCount <= 0)) return;
+
+    int frameCount = anim->frameCount;
+    int boneCount = anim->boneCount;
+
+    rlAnimationKeys *keys = (rlAnimationKeys *)RL_CALLOC(1, sizeof(rlAnimationKeys));
+    keys->frameCount = frameCount;
+    keys->boneCount = boneCount;
+    keys->tracks = (AnimationTrack *)RL_MALLOC(boneCount*3*sizeof(AnimationTrack));
+
+    // Keys arrays are allocated for the worst case (no frame removed) and shrinked at the end
+    keys->vectorFrames = (float *)RL_MALLOC(boneCount*2*frameCount*sizeof(float));
+    keys->vectors = (float *)RL_MALLOC(boneCount*2*frameCount*3*sizeof(float));
+    keys->rotationFrames = (float *)RL_MALLOC(boneCount*frameCount*sizeof(float));
+    keys->rotations = (unsigned short *)RL_MALLOC(boneCount*frameCount*3*sizeof(unsigned short));
+
+    float *values = (float *)RL_MALLOC(frameCount*4*sizeof(float));
+    float *decoded = (float *)RL_MALLOC(frameCount*4*sizeof(float));
+    unsigned short *quantized = (unsigned short *)RL_MALLOC(frameCount*3*sizeof(unsigned short));
+    int *keyFrames = (int *)RL_MALLOC(frameCount*sizeof(int));
+    int vectorKeyCount = 0;
+    int rotationKeyCount = 0;
+
+    for (int b = 0; b < boneCount; b++)
+    {
+        for (int t = 0; t < 3; t++)
+        {
+            AnimationTrack *track = &keys->tracks[b*3 + t];
+
+            if (t == 1)
+            {
+                // Rotation track: keys are checked with quantized values
+                for (int f = 0; f < frameCount; f++)
+                {
+                    Quaternion q = QuaternionNormalize(anim->framePoses[f][b].rotation);
+                    values[f*4] = q.x;
+                    values[f*4 + 1] = q.y;
+                    values[f*4 + 2] = q.z;
+                    values[f*4 + 3] = q.w;
+
+                    QuantizeAnimationRotation(&values[f*4], &quantized[f*3]);
+                    DequantizeAnimationRotation(&quantized[f*3], &decoded[f*4]);
+                }
+
+                track->firstKey = rotationKeyCount;
+                track->keyCount = ReduceAnimationTrack(values, decoded, frameCount, 4, tolerance, keyFrames);
+
+                for (int k = 0; k < track->keyCount; k++, rotationKeyCount++)
+                {
+                    keys->rotationFrames[rotationKeyCount] = (float)keyFrames[k];
+                    memcpy(&keys->rotations[rotationKeyCount*3], &quantized[keyFrames[k]*3], 3*sizeof(unsigned short));
+                }
+            }
+            else
+            {
+                // Translation or scale track
+                for (int f = 0; f < frameCount; f++)
+                {
+                    rlVector3 v = (t == 0)? anim->framePoses[f][b].translation : anim->framePoses[f][b].scale;
+                    values[f*3] = v.x;
+                    values[f*3 + 1] = v.y;
+                    values[f*3 + 2] = v.z;
+                }
+
+                track->firstKey = vectorKeyCount;
+                track->keyCount = ReduceAnimationTrack(values, values, frameCount, 3, tolerance, keyFrames);
+
+                for (int k = 0; k < track->keyCount; k++, vectorKeyCount++)
+                {
+                    keys->vectorFrames[vectorKeyCount] = (float)keyFrames[k];
+                    memcpy(&keys->vectors[vectorKeyCount*3], &values[keyFrames[k]*3], 3*sizeof(float));
+                }
+            }
+        }
+    }
+
+    RL_FREE(values);
+    RL_FREE(decoded);
+    RL_FREE(quantized);
+    RL_FREE(keyFrames);
+
+    keys->vectorFrames = (float *)RL_REALLOC(keys->vectorFrames, vectorKeyCount*sizeof(float));
+    keys->vectors = (float *)RL_REALLOC(keys->vectors, vectorKeyCount*3*sizeof(float));
+    keys->rotationFrames = (float *)RL_REALLOC(keys->rotationFrames, rotationKeyCount*sizeof(float));
+    keys->rotations = (unsigned short *)RL_REALLOC(keys->rotations, rotationKeyCount*3*sizeof(unsigned short));
+
+    keys->vectorKeyCount = vectorKeyCount;
+    keys->rotationKeyCount = rotationKeyCount;
+
+    int posesSize = frameCount*(boneCount*(int)sizeof(rlTransform) + (int)sizeof(rlTransform *));
+    int keysSize = GetAnimationKeysSize(keys);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Animation keyframes compressed: %i KB -> %i KB (%i KB saved, %i keys for %i frames)",
+        anim->name, posesSize/1024, keysSize/1024, (posesSize - keysSize)/1024, vectorKeyCount + rotationKeyCount, frameCount);
+
+    for (int f = 0; f < frameCount; f++) RL_FREE(anim->framePoses[f]);
+    RL_FREE(anim->framePoses);
+
+    anim->framePoses = NULL;
+    anim->keys = keys;
+}
+
 #if defined(SUPPORT_MESH_GENERATION)
 // Generate polygonal mesh
 rlMesh rlGenMeshPoly(int sides, float radius)
@@ -4027,22 +4982,7 @@ rlRayCollision rlGetRayCollisionBox(rlRay ray, rlBoundingBox box)
     collision.hit = !((t[7] < 0) || (t[6] > t[7]));
     collision.distance = t[6];
     collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
-
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
-
-    collision.normal = Vector3Normalize(collision.normal);
+    collision.normal = GetRayCollisionBoxNormal(box, collision.point);
 
     if (insideBox)
     {
@@ -4102,104 +5042,1963 @@ rlRayCollision rlGetRayCollisionMesh(rlRay ray, rlMesh mesh, rlMatrix transform)
     return collision;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-rlRayCollision rlGetRayCollisionTriangle(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3)
+// Load mesh bounding volume hierarchy for ray queries
+// NOTE: Built once from mesh vertex data (mesh space), it can be used with any transform,
+// so models sharing the mesh can share the hierarchy. Triangles are binned by centroid and
+// split by surface area heuristic (SAH), triangles are copied in leaf order for cache locality
+rlMeshBVH rlLoadMeshBVH(rlMesh mesh)
 {
-    #define EPSILON 0.000001f        // A small number
+    rlMeshBVH bvh = { 0 };
 
-    rlRayCollision collision = { 0 };
-    rlVector3 edge1 = { 0 };
-    rlVector3 edge2 = { 0 };
-    rlVector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0)) return bvh;
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+    int triangleCount = mesh.triangleCount;
+    int *indices = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    rlVector3 *centroids = (rlVector3 *)RL_MALLOC(triangleCount*sizeof(rlVector3));
+    rlBoundingBox *bounds = (rlBoundingBox *)RL_MALLOC(triangleCount*sizeof(rlBoundingBox));
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+    for (int i = 0; i < triangleCount; i++)
+    {
+        rlVector3 a, b, c;
+        GetMeshTriangle(mesh, i, &a, &b, &c);
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+        indices[i] = i;
+        bounds[i].min = Vector3Min(Vector3Min(a, b), c);
+        bounds[i].max = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(bounds[i].min, bounds[i].max), 0.5f);
+    }
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+    // NOTE: A binary tree with N leaves at most has 2*N - 1 nodes
+    bvh.nodes = (rlMeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(rlMeshBVHNode));
+    bvh.nodes[0].first = 0;
+    bvh.nodes[0].count = triangleCount;
+    bvh.nodeCount = 1;
 
-    invDet = 1.0f/det;
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackDepth[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackCount = 1;
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+    while (stackCount > 0)
+    {
+        stackCount--;
+        rlMeshBVHNode *node = &bvh.nodes[stack[stackCount]];
+        int depth = stackDepth[stackCount];
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+        // Compute node bounds and centroids bounds
+        rlVector3 centroidMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+        rlVector3 centroidMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        node->min = centroidMin;
+        node->max = centroidMax;
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+        for (int i = node->first; i < (node->first + node->count); i++)
+        {
+            node->min = Vector3Min(node->min, bounds[indices[i]].min);
+            node->max = Vector3Max(node->max, bounds[indices[i]].max);
+            centroidMin = Vector3Min(centroidMin, centroids[indices[i]]);
+            centroidMax = Vector3Max(centroidMax, centroids[indices[i]]);
+        }
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+        if ((node->count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+        // Find best split: axis and bin with lowest SAH cost
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = FLT_MAX;
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float axisMin = ((float *)&centroidMin)[axis];
+            float extent = ((float *)&centroidMax)[axis] - axisMin;
+            if (extent <= 0.0f) continue;
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+            int binCount[MESH_BVH_BINS] = { 0 };
+            rlBoundingBox binBounds[MESH_BVH_BINS] = { 0 };
+            float scale = MESH_BVH_BINS/extent;
 
-    if (t > EPSILON)
-    {
-        // rlRay hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
-    }
+            for (int b = 0; b < MESH_BVH_BINS; b++) binBounds[b] = (rlBoundingBox){ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
 
-    return collision;
-}
+            for (int i = node->first; i < (node->first + node->count); i++)
+            {
+                int b = (int)((((float *)&centroids[indices[i]])[axis] - axisMin)*scale);
+                if (b > (MESH_BVH_BINS - 1)) b = MESH_BVH_BINS - 1;
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-rlRayCollision rlGetRayCollisionQuad(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3, rlVector3 p4)
-{
-    rlRayCollision collision = { 0 };
+                binCount[b]++;
+                binBounds[b].min = Vector3Min(binBounds[b].min, bounds[indices[i]].min);
+                binBounds[b].max = Vector3Max(binBounds[b].max, bounds[indices[i]].max);
+            }
 
-    collision = rlGetRayCollisionTriangle(ray, p1, p2, p4);
+            // Sweep bins from both sides, cost = count*area for both split sides
+            float leftArea[MESH_BVH_BINS - 1] = { 0 };
+            int leftCount[MESH_BVH_BINS - 1] = { 0 };
+            rlBoundingBox box = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+            int count = 0;
 
-    if (!collision.hit) collision = rlGetRayCollisionTriangle(ray, p2, p3, p4);
+            for (int b = 0; b < (MESH_BVH_BINS - 1); b++)
+            {
+                count += binCount[b];
+                box.min = Vector3Min(box.min, binBounds[b].min);
+                box.max = Vector3Max(box.max, binBounds[b].max);
+                rlVector3 size = Vector3Subtract(box.max, box.min);
 
-    return collision;
-}
+                leftCount[b] = count;
+                leftArea[b] = (count > 0)? (size.x*size.y + size.y*size.z + size.z*size.x) : 0.0f;
+            }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(rlBoneInfo *bones, int boneCount, rlTransform *transforms)
-{
-    for (int i = 0; i < boneCount; i++)
-    {
-        if (bones[i].parent >= 0)
-        {
-            if (bones[i].parent > i)
+            box = (rlBoundingBox){ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+            count = 0;
+
+            for (int b = MESH_BVH_BINS - 1; b > 0; b--)
             {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
+                count += binCount[b];
+                box.min = Vector3Min(box.min, binBounds[b].min);
+                box.max = Vector3Max(box.max, binBounds[b].max);
+                rlVector3 size = Vector3Subtract(box.max, box.min);
+
+                if ((leftCount[b - 1] == 0) || (count == 0)) continue;
+
+                float cost = leftCount[b - 1]*leftArea[b - 1] + count*(size.x*size.y + size.y*size.z + size.z*size.x);
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                }
             }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+        }
+
+        // No valid split (all centroids at the same position), keep node as leaf
+        if (bestAxis == -1) continue;
+
+        // Partition triangles: bins lower than split to the left side
+        float axisMin = ((float *)&centroidMin)[bestAxis];
+        float scale = MESH_BVH_BINS/(((float *)&centroidMax)[bestAxis] - axisMin);
+        int left = node->first;
+        int right = node->first + node->count - 1;
+
+        while (left <= right)
+        {
+            int b = (int)((((float *)&centroids[indices[left]])[bestAxis] - axisMin)*scale);
+            if (b > (MESH_BVH_BINS - 1)) b = MESH_BVH_BINS - 1;
+
+            if (b < bestSplit) left++;
+            else
+            {
+                int temp = indices[left];
+                indices[left] = indices[right];
+                indices[right] = temp;
+                right--;
+            }
+        }
+
+        int leftCount = left - node->first;
+
+        // Create children nodes, right child next to left child
+        int child = bvh.nodeCount;
+        bvh.nodeCount += 2;
+
+        bvh.nodes[child].first = node->first;
+        bvh.nodes[child].count = leftCount;
+        bvh.nodes[child + 1].first = left;
+        bvh.nodes[child + 1].count = node->count - leftCount;
+
+        node->first = child;
+        node->count = 0;
+
+        stack[stackCount] = child + 1;
+        stackDepth[stackCount] = depth + 1;
+        stack[stackCount + 1] = child;
+        stackDepth[stackCount + 1] = depth + 1;
+        stackCount += 2;
+    }
+
+    // Copy triangles vertex positions in leaf order
+    bvh.triangleCount = triangleCount;
+    bvh.triangles = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        rlVector3 a, b, c;
+        GetMeshTriangle(mesh, indices[i], &a, &b, &c);
+
+        float *triangle = &bvh.triangles[i*9];
+        triangle[0] = a.x; triangle[1] = a.y; triangle[2] = a.z;
+        triangle[3] = b.x; triangle[4] = b.y; triangle[5] = b.z;
+        triangle[6] = c.x; triangle[7] = c.y; triangle[8] = c.z;
+    }
+
+    bvh.nodes = (rlMeshBVHNode *)RL_REALLOC(bvh.nodes, bvh.nodeCount*sizeof(rlMeshBVHNode));
+
+    RL_FREE(indices);
+    RL_FREE(centroids);
+    RL_FREE(bounds);
+
+    TRACELOG(LOG_INFO, "MESH: BVH built successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void rlUnloadMeshBVH(rlMeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.triangles);
+}
+
+// Get collision info between ray and mesh using its bounding volume hierarchy
+// NOTE: rlRay is transformed into mesh space once (no vertex transformation), the ray parameter
+// is the same in both spaces, so returned distance matches rlGetRayCollisionMesh()
+rlRayCollision rlGetRayCollisionMeshBVH(rlRay ray, rlMeshBVH bvh, rlMatrix transform)
+{
+    rlRayCollision collision = { 0 };
+
+    if (bvh.nodeCount == 0) return collision;
+
+    rlMatrix invTransform = MatrixInvert(transform);
+    rlRay meshRay = GetRayMeshSpace(ray, invTransform);
+
+    float distance = 0.0f;
+    int triangle = GetRayBVHTriangle(bvh, meshRay, &distance);
+
+    if (triangle >= 0) collision = GetRayCollisionMeshHit(ray, &bvh.triangles[triangle*9], distance, invTransform, (MatrixDeterminant(transform) < 0.0f));
+
+    return collision;
+}
+
+// Get collision info between rays and sphere
+void rlGetRayCollisionSphereBatch(const rlRay *rays, int count, rlVector3 center, float radius, rlRayCollision *collisions)
+{
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.center = center;
+    job.radius = radius;
+
+    RunParallelFor(RayBatchSphereJob, &job, (count + RAY_PACKET_SIZE - 1)/RAY_PACKET_SIZE);
+}
+
+// Get collision info between rays and box
+void rlGetRayCollisionBoxBatch(const rlRay *rays, int count, rlBoundingBox box, rlRayCollision *collisions)
+{
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.box = box;
+
+    RunParallelFor(RayBatchBoxJob, &job, (count + RAY_PACKET_SIZE - 1)/RAY_PACKET_SIZE);
+}
+
+// Get collision info between rays and mesh
+// NOTE: Rays are transformed into mesh space, every triangle is tested against a full packet
+void rlGetRayCollisionMeshBatch(const rlRay *rays, int count, rlMesh mesh, rlMatrix transform, rlRayCollision *collisions)
+{
+    if (mesh.vertices == NULL)
+    {
+        for (int i = 0; i < count; i++) collisions[i] = (rlRayCollision){ 0 };
+        return;
+    }
+
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.mesh = mesh;
+    job.invTransform = MatrixInvert(transform);
+    job.mirrored = (MatrixDeterminant(transform) < 0.0f);
+
+    RunParallelFor(RayBatchMeshJob, &job, (count + RAY_PACKET_SIZE - 1)/RAY_PACKET_SIZE);
+}
+
+// Get collision info between rays and mesh using its bounding volume hierarchy
+// NOTE: Rays traverse the hierarchy one by one (divergent paths), jobs are split by rays
+void rlGetRayCollisionMeshBVHBatch(const rlRay *rays, int count, rlMeshBVH bvh, rlMatrix transform, rlRayCollision *collisions)
+{
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.bvh = bvh;
+    job.invTransform = MatrixInvert(transform);
+    job.mirrored = (MatrixDeterminant(transform) < 0.0f);
+
+    RunParallelFor(RayBatchMeshBVHJob, &job, count);
+}
+
+// Get collision info between rays and triangle
+void rlGetRayCollisionTriangleBatch(const rlRay *rays, int count, rlVector3 p1, rlVector3 p2, rlVector3 p3, rlRayCollision *collisions)
+{
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.triangle[0] = p1.x; job.triangle[1] = p1.y; job.triangle[2] = p1.z;
+    job.triangle[3] = p2.x; job.triangle[4] = p2.y; job.triangle[5] = p2.z;
+    job.triangle[6] = p3.x; job.triangle[7] = p3.y; job.triangle[8] = p3.z;
+
+    RunParallelFor(RayBatchTriangleJob, &job, (count + RAY_PACKET_SIZE - 1)/RAY_PACKET_SIZE);
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+rlRayCollision rlGetRayCollisionTriangle(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    rlRayCollision collision = { 0 };
+    rlVector3 edge1 = { 0 };
+    rlVector3 edge2 = { 0 };
+    rlVector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // rlRay hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+rlRayCollision rlGetRayCollisionQuad(rlRay ray, rlVector3 p1, rlVector3 p2, rlVector3 p3, rlVector3 p4)
+{
+    rlRayCollision collision = { 0 };
+
+    collision = rlGetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = rlGetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+// Load dynamic bounding box tree
+// NOTE: Proxies store bounds enlarged by margin, moving proxies only update the tree when
+// leaving their enlarged bounds, tree is kept balanced by rotations (AVL)
+rlAABBTree *rlLoadAABBTree(float margin, int capacity)
+{
+    rlAABBTree *tree = (rlAABBTree *)RL_CALLOC(1, sizeof(rlAABBTree));
+
+    if (capacity < 16) capacity = 16;
+
+    // NOTE: Every proxy requires one leaf node and one inner node
+    tree->nodeCapacity = 2*capacity;
+    tree->nodes = (AABBTreeNode *)RL_MALLOC(tree->nodeCapacity*sizeof(AABBTreeNode));
+    tree->freeNode = -1;
+    tree->root = -1;
+    tree->margin = (margin > 0.0f)? margin : 0.0f;
+
+    return tree;
+}
+
+// Unload dynamic bounding box tree
+void rlUnloadAABBTree(rlAABBTree *tree)
+{
+    if (tree == NULL) return;
+
+    RL_FREE(tree->nodes);
+    RL_FREE(tree);
+}
+
+// Add bounding box to tree, returns proxy id
+// NOTE: Model bounds can be provided directly, see rlGetModelBoundingBox()
+int rlAddAABBTreeProxy(rlAABBTree *tree, rlBoundingBox box)
+{
+    int id = AllocateAABBTreeNode(tree);
+    AABBTreeNode *node = &tree->nodes[id];
+
+    rlVector3 margin = { tree->margin, tree->margin, tree->margin };
+    node->box = (rlBoundingBox){ Vector3Subtract(box.min, margin), Vector3Add(box.max, margin) };
+    node->proxyBox = box;
+    node->height = 0;
+
+    InsertAABBTreeLeaf(tree, id);
+
+    return id;
+}
+
+// Update proxy bounding box
+// NOTE: Tree is only updated if box leaves proxy enlarged bounds
+bool rlUpdateAABBTreeProxy(rlAABBTree *tree, int id, rlBoundingBox box)
+{
+    if ((id < 0) || (id >= tree->nodeCount) || (tree->nodes[id].height != 0)) return false;
+
+    AABBTreeNode *node = &tree->nodes[id];
+    node->proxyBox = box;
+
+    if ((box.min.x >= node->box.min.x) && (box.min.y >= node->box.min.y) && (box.min.z >= node->box.min.z) &&
+        (box.max.x <= node->box.max.x) && (box.max.y <= node->box.max.y) && (box.max.z <= node->box.max.z)) return false;
+
+    RemoveAABBTreeLeaf(tree, id);
+
+    rlVector3 margin = { tree->margin, tree->margin, tree->margin };
+    tree->nodes[id].box = (rlBoundingBox){ Vector3Subtract(box.min, margin), Vector3Add(box.max, margin) };
+
+    InsertAABBTreeLeaf(tree, id);
+
+    return true;
+}
+
+// Remove proxy from tree
+void rlRemoveAABBTreeProxy(rlAABBTree *tree, int id)
+{
+    if ((id < 0) || (id >= tree->nodeCount) || (tree->nodes[id].height != 0)) return;
+
+    RemoveAABBTreeLeaf(tree, id);
+    FreeAABBTreeNode(tree, id);
+}
+
+// Get colliding proxies pairs, pairs ids written as [id1, id2] with id1 < id2
+// NOTE: Every proxy queries the tree with its bounds, pairs are reported by lower id proxy
+int rlGetAABBTreePairs(rlAABBTree *tree, int *pairs, int maxPairs)
+{
+    int pairCount = 0;
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+
+    for (int i = 0; i < tree->nodeCount; i++)
+    {
+        if (tree->nodes[i].height != 0) continue;
+
+        rlBoundingBox box = tree->nodes[i].proxyBox;
+        int stackCount = 0;
+
+        if (tree->root != -1) stack[stackCount++] = tree->root;
+
+        while (stackCount > 0)
+        {
+            const AABBTreeNode *node = &tree->nodes[stack[--stackCount]];
+
+            if (!rlCheckCollisionBoxes(node->box, box)) continue;
+
+            if (node->height == 0)
+            {
+                int other = (int)(node - tree->nodes);
+
+                if ((other > i) && rlCheckCollisionBoxes(node->proxyBox, box))
+                {
+                    if (pairCount < maxPairs)
+                    {
+                        pairs[pairCount*2] = i;
+                        pairs[pairCount*2 + 1] = other;
+                    }
+
+                    pairCount++;
+                }
+            }
+            else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+            {
+                stack[stackCount++] = node->child1;
+                stack[stackCount++] = node->child2;
+            }
+        }
+    }
+
+    return pairCount;
+}
+
+// Get proxies colliding with box
+int rlGetAABBTreeCollisionsBox(rlAABBTree *tree, rlBoundingBox box, int *ids, int maxIds)
+{
+    int count = 0;
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    if (tree->root != -1) stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = stack[--stackCount];
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        if (!rlCheckCollisionBoxes(node->box, box)) continue;
+
+        if (node->height == 0)
+        {
+            if (rlCheckCollisionBoxes(node->proxyBox, box))
+            {
+                if (count < maxIds) ids[count] = index;
+                count++;
+            }
+        }
+        else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get proxies colliding with sphere
+int rlGetAABBTreeCollisionsSphere(rlAABBTree *tree, rlVector3 center, float radius, int *ids, int maxIds)
+{
+    int count = 0;
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    if (tree->root != -1) stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = stack[--stackCount];
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        if (!rlCheckCollisionBoxSphere(node->box, center, radius)) continue;
+
+        if (node->height == 0)
+        {
+            if (rlCheckCollisionBoxSphere(node->proxyBox, center, radius))
+            {
+                if (count < maxIds) ids[count] = index;
+                count++;
+            }
+        }
+        else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get proxies hit by ray (unordered)
+int rlGetAABBTreeCollisionsRay(rlAABBTree *tree, rlRay ray, int *ids, int maxIds)
+{
+    int count = 0;
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    rlVector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+
+    if (tree->root != -1) stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = stack[--stackCount];
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        if (GetRayBoxDistance(ray.position, invDirection, node->box.min, node->box.max) == FLT_MAX) continue;
+
+        if (node->height == 0)
+        {
+            if (rlGetRayCollisionBox(ray, node->proxyBox).hit)
+            {
+                if (count < maxIds) ids[count] = index;
+                count++;
+            }
+        }
+        else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get proxies inside or intersecting camera frustum
+// NOTE: Frustum planes are extracted from view*projection matrix, as computed by
+// MatrixMultiply(view, projection), boxes outside any plane are culled
+int rlGetAABBTreeCollisionsFrustum(rlAABBTree *tree, rlMatrix viewProjection, int *ids, int maxIds)
+{
+    rlMatrix m = viewProjection;
+    float planes[24] = {
+        m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12,      // Left
+        m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12,      // Right
+        m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13,      // Bottom
+        m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13,      // Top
+        m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14,     // Near
+        m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14      // Far
+    };
+
+    int count = 0;
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    if (tree->root != -1) stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = stack[--stackCount];
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        if (!CheckCollisionBoxFrustum(node->box, planes)) continue;
+
+        if (node->height == 0)
+        {
+            if (CheckCollisionBoxFrustum(node->proxyBox, planes))
+            {
+                if (count < maxIds) ids[count] = index;
+                count++;
+            }
+        }
+        else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get collision info between ray and closest proxy
+// NOTE: Nodes traversed nearest first, nodes farther than closest hit are skipped
+rlRayCollision rlGetAABBTreeRayCollision(rlAABBTree *tree, rlRay ray, int *id)
+{
+    rlRayCollision collision = { 0 };
+    int closestId = -1;
+    float closest = FLT_MAX;
+
+    int stack[AABB_TREE_STACK_SIZE] = { 0 };
+    float stackDistance[AABB_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    rlVector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+
+    if (tree->root != -1)
+    {
+        stackDistance[0] = GetRayBoxDistance(ray.position, invDirection, tree->nodes[tree->root].box.min, tree->nodes[tree->root].box.max);
+        if (stackDistance[0] < FLT_MAX) stack[stackCount++] = tree->root;
+    }
+
+    while (stackCount > 0)
+    {
+        stackCount--;
+        if (stackDistance[stackCount] > closest) continue;
+
+        int index = stack[stackCount];
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        if (node->height == 0)
+        {
+            rlRayCollision proxyCollision = rlGetRayCollisionBox(ray, node->proxyBox);
+
+            // NOTE: Ray starting inside box reports negative distance, considered as distance 0
+            float distance = (proxyCollision.distance > 0.0f)? proxyCollision.distance : 0.0f;
+
+            if (proxyCollision.hit && (distance < closest))
+            {
+                closest = distance;
+                closestId = index;
+                collision = proxyCollision;
+            }
+        }
+        else if (stackCount < (AABB_TREE_STACK_SIZE - 1))
+        {
+            int nearChild = node->child1;
+            int farChild = node->child2;
+            float nearDistance = GetRayBoxDistance(ray.position, invDirection, tree->nodes[nearChild].box.min, tree->nodes[nearChild].box.max);
+            float farDistance = GetRayBoxDistance(ray.position, invDirection, tree->nodes[farChild].box.min, tree->nodes[farChild].box.max);
+
+            if (farDistance < nearDistance)
+            {
+                int temp = nearChild;
+                nearChild = farChild;
+                farChild = temp;
+
+                float tempDistance = nearDistance;
+                nearDistance = farDistance;
+                farDistance = tempDistance;
+            }
+
+            if (farDistance <= closest)
+            {
+                stack[stackCount] = farChild;
+                stackDistance[stackCount] = farDistance;
+                stackCount++;
+            }
+
+            if (nearDistance <= closest)
+            {
+                stack[stackCount] = nearChild;
+                stackDistance[stackCount] = nearDistance;
+                stackCount++;
+            }
+        }
+    }
+
+    if (id != NULL) *id = closestId;
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Attach (enable) or detach instance buffer attributes to current vertex array (or global state if no VAO)
+// NOTE: Transforms use shader location SHADER_LOC_MATRIX_MODEL (4 consecutive locations),
+// colors use SHADER_LOC_VERTEX_INSTANCE_COLOR, custom attributes use their provided locations
+static void SetInstanceBufferAttribs(rlInstanceBuffer buffer, rlShader shader, bool enable)
+{
+    int transformLoc = shader.locs[SHADER_LOC_MATRIX_MODEL];
+    int colorLoc = shader.locs[SHADER_LOC_VERTEX_INSTANCE_COLOR];
+
+    if (transformLoc != -1)
+    {
+        if (enable) rlEnableVertexBuffer(buffer.transformsVboId);
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (enable)
+            {
+                rlEnableVertexAttribute(transformLoc + i);
+                rlSetVertexAttribute(transformLoc + i, 4, RL_FLOAT, 0, sizeof(rlMatrix), i*sizeof(rlVector4));
+                rlSetVertexAttributeDivisor(transformLoc + i, 1);
+            }
+            else
+            {
+                rlSetVertexAttributeDivisor(transformLoc + i, 0);
+                rlDisableVertexAttribute(transformLoc + i);
+            }
+        }
+    }
+
+    if (colorLoc != -1)
+    {
+        if (enable && (buffer.colorsVboId > 0))
+        {
+            rlEnableVertexBuffer(buffer.colorsVboId);
+            rlEnableVertexAttribute(colorLoc);
+            rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            rlSetVertexAttributeDivisor(colorLoc, 1);
+        }
+        else
+        {
+            // Set default value for instance color, white if no instance colors provided
+            float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            if (buffer.colorsVboId > 0) rlSetVertexAttributeDivisor(colorLoc, 0);
+            rlDisableVertexAttribute(colorLoc);
+            rlSetVertexAttributeDefault(colorLoc, value, SHADER_ATTRIB_VEC4, 4);
+        }
+    }
+
+    for (int i = 0; i < buffer.attribCount; i++)
+    {
+        if (enable)
+        {
+            rlEnableVertexBuffer(buffer.attribVboId[i]);
+            rlEnableVertexAttribute(buffer.attribLocs[i]);
+            rlSetVertexAttribute(buffer.attribLocs[i], buffer.attribComponents[i], RL_FLOAT, 0, 0, 0);
+            rlSetVertexAttributeDivisor(buffer.attribLocs[i], 1);
+        }
+        else
+        {
+            rlSetVertexAttributeDivisor(buffer.attribLocs[i], 0);
+            rlDisableVertexAttribute(buffer.attribLocs[i]);
+        }
+    }
+
+    if (enable) rlDisableVertexBuffer();
+}
+
+// Get mesh triangle vertex positions (indexed or not)
+static void GetMeshTriangle(rlMesh mesh, int index, rlVector3 *a, rlVector3 *b, rlVector3 *c)
+{
+    rlVector3 *vertdata = (rlVector3 *)mesh.vertices;
+
+    if (mesh.indices != NULL)
+    {
+        *a = vertdata[mesh.indices[index*3 + 0]];
+        *b = vertdata[mesh.indices[index*3 + 1]];
+        *c = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        *a = vertdata[index*3 + 0];
+        *b = vertdata[index*3 + 1];
+        *c = vertdata[index*3 + 2];
+    }
+}
+
+// Get ray entry distance into box (slab test), FLT_MAX if no hit
+// NOTE: Distance is 0 if ray origin is inside the box
+static float GetRayBoxDistance(rlVector3 origin, rlVector3 invDirection, rlVector3 min, rlVector3 max)
+{
+    float t1 = (min.x - origin.x)*invDirection.x;
+    float t2 = (max.x - origin.x)*invDirection.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (min.y - origin.y)*invDirection.y;
+    t2 = (max.y - origin.y)*invDirection.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (min.z - origin.z)*invDirection.z;
+    t2 = (max.z - origin.z)*invDirection.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    if ((tmax < 0.0f) || (tmin > tmax)) return FLT_MAX;
+
+    return (tmin > 0.0f)? tmin : 0.0f;
+}
+
+// Get ray distance to triangle, same test as rlGetRayCollisionTriangle() without hit info
+// NOTE: Triangle provided as 9 floats (3 vertex positions)
+static bool GetRayTriangleDistance(rlVector3 origin, rlVector3 direction, const float *triangle, float *distance)
+{
+    const float epsilon = 0.000001f;
+
+    rlVector3 p1 = { triangle[0], triangle[1], triangle[2] };
+    rlVector3 edge1 = { triangle[3] - p1.x, triangle[4] - p1.y, triangle[5] - p1.z };
+    rlVector3 edge2 = { triangle[6] - p1.x, triangle[7] - p1.y, triangle[8] - p1.z };
+
+    rlVector3 p = Vector3CrossProduct(direction, edge2);
+    float det = Vector3DotProduct(edge1, p);
+    if ((det > -epsilon) && (det < epsilon)) return false;
+
+    float invDet = 1.0f/det;
+    rlVector3 tv = Vector3Subtract(origin, p1);
+
+    float u = Vector3DotProduct(tv, p)*invDet;
+    if ((u < 0.0f) || (u > 1.0f)) return false;
+
+    rlVector3 q = Vector3CrossProduct(tv, edge1);
+    float v = Vector3DotProduct(direction, q)*invDet;
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return false;
+
+    float t = Vector3DotProduct(edge2, q)*invDet;
+    if (t <= epsilon) return false;
+
+    *distance = t;
+    return true;
+}
+
+// Get ray transformed into mesh space
+// NOTE: Direction is not normalized so ray parameter (distance) is the same in both spaces
+static rlRay GetRayMeshSpace(rlRay ray, rlMatrix invTransform)
+{
+    rlRay meshRay = { 0 };
+
+    meshRay.position = Vector3Transform(ray.position, invTransform);
+    meshRay.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+    meshRay.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+    meshRay.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+    return meshRay;
+}
+
+// Get closest triangle hit by mesh space ray, -1 if no hit
+// NOTE: Nodes traversed nearest first, nodes farther than closest hit are skipped
+static int GetRayBVHTriangle(rlMeshBVH bvh, rlRay meshRay, float *distance)
+{
+    rlVector3 origin = meshRay.position;
+    rlVector3 direction = meshRay.direction;
+    rlVector3 invDirection = { 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+
+    float closest = FLT_MAX;
+    int closestTriangle = -1;
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    float stackDistance[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackCount = 0;
+
+    float rootDistance = GetRayBoxDistance(origin, invDirection, bvh.nodes[0].min, bvh.nodes[0].max);
+    if (rootDistance < FLT_MAX)
+    {
+        stack[0] = 0;
+        stackDistance[0] = rootDistance;
+        stackCount = 1;
+    }
+
+    while (stackCount > 0)
+    {
+        stackCount--;
+        if (stackDistance[stackCount] >= closest) continue;
+
+        const rlMeshBVHNode *node = &bvh.nodes[stack[stackCount]];
+
+        if (node->count > 0)
+        {
+            for (int i = node->first; i < (node->first + node->count); i++)
+            {
+                float triangleDistance = 0.0f;
+
+                if (GetRayTriangleDistance(origin, direction, &bvh.triangles[i*9], &triangleDistance) && (triangleDistance < closest))
+                {
+                    closest = triangleDistance;
+                    closestTriangle = i;
+                }
+            }
+        }
+        else
+        {
+            int nearChild = node->first;
+            int farChild = node->first + 1;
+            float nearDistance = GetRayBoxDistance(origin, invDirection, bvh.nodes[nearChild].min, bvh.nodes[nearChild].max);
+            float farDistance = GetRayBoxDistance(origin, invDirection, bvh.nodes[farChild].min, bvh.nodes[farChild].max);
+
+            if (farDistance < nearDistance)
+            {
+                int temp = nearChild;
+                nearChild = farChild;
+                farChild = temp;
+
+                float tempDistance = nearDistance;
+                nearDistance = farDistance;
+                farDistance = tempDistance;
+            }
+
+            if (farDistance < closest)
+            {
+                stack[stackCount] = farChild;
+                stackDistance[stackCount] = farDistance;
+                stackCount++;
+            }
+
+            if (nearDistance < closest)
+            {
+                stack[stackCount] = nearChild;
+                stackDistance[stackCount] = nearDistance;
+                stackCount++;
+            }
+        }
+    }
+
+    *distance = closest;
+
+    return closestTriangle;
+}
+
+// Get world space collision info for mesh triangle hit
+// NOTE: Normal transformed by inverse transpose matrix, winding is flipped by mirroring transforms
+static rlRayCollision GetRayCollisionMeshHit(rlRay ray, const float *triangle, float distance, rlMatrix invTransform, bool mirrored)
+{
+    rlRayCollision collision = { 0 };
+
+    rlVector3 edge1 = { triangle[3] - triangle[0], triangle[4] - triangle[1], triangle[5] - triangle[2] };
+    rlVector3 edge2 = { triangle[6] - triangle[0], triangle[7] - triangle[1], triangle[8] - triangle[2] };
+    rlVector3 normal = Vector3CrossProduct(edge1, edge2);
+
+    rlVector3 worldNormal = {
+        invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z,
+        invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z,
+        invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z
+    };
+    if (mirrored) worldNormal = Vector3Negate(worldNormal);
+
+    collision.hit = true;
+    collision.distance = distance;
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+    collision.normal = Vector3Normalize(worldNormal);
+
+    return collision;
+}
+
+// Get box face normal at collision point
+static rlVector3 GetRayCollisionBoxNormal(rlBoundingBox box, rlVector3 point)
+{
+    // Get box center point
+    rlVector3 normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    normal = Vector3Subtract(point, normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    normal = Vector3Scale(normal, 2.01f);
+    normal = Vector3Divide(normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    normal.x = (float)((int)normal.x);
+    normal.y = (float)((int)normal.y);
+    normal.z = (float)((int)normal.z);
+
+    return Vector3Normalize(normal);
+}
+
+// Load rays packet from rays array, optionally transformed into mesh space
+// NOTE: Lanes past the end of the array repeat last ray, results for those lanes are discarded
+static int LoadRayPacket(RayPacket *packet, const rlRay *rays, int count, int first, const rlMatrix *invTransform)
+{
+    int valid = count - first;
+    if (valid > RAY_PACKET_SIZE) valid = RAY_PACKET_SIZE;
+
+    for (int k = 0; k < RAY_PACKET_SIZE; k++)
+    {
+        rlRay ray = rays[first + ((k < valid)? k : (valid - 1))];
+        if (invTransform != NULL) ray = GetRayMeshSpace(ray, *invTransform);
+
+        packet->ox[k] = ray.position.x;
+        packet->oy[k] = ray.position.y;
+        packet->oz[k] = ray.position.z;
+        packet->dx[k] = ray.direction.x;
+        packet->dy[k] = ray.direction.y;
+        packet->dz[k] = ray.direction.z;
+    }
+
+    return valid;
+}
+
+// Update packet closest hits with triangle, same test as rlGetRayCollisionTriangle()
+// NOTE: Branchless lanes loop, all rays tested with same operations (vectorized by compiler)
+static void GetRayPacketTriangle(const RayPacket *packet, const float *triangle, int index, float *closest, int *closestIndex)
+{
+    const float epsilon = 0.000001f;
+
+    float p1x = triangle[0], p1y = triangle[1], p1z = triangle[2];
+    float e1x = triangle[3] - p1x, e1y = triangle[4] - p1y, e1z = triangle[5] - p1z;
+    float e2x = triangle[6] - p1x, e2y = triangle[7] - p1y, e2z = triangle[8] - p1z;
+
+    for (int k = 0; k < RAY_PACKET_SIZE; k++)
+    {
+        float px = packet->dy[k]*e2z - packet->dz[k]*e2y;
+        float py = packet->dz[k]*e2x - packet->dx[k]*e2z;
+        float pz = packet->dx[k]*e2y - packet->dy[k]*e2x;
+        float det = e1x*px + e1y*py + e1z*pz;
+        float invDet = 1.0f/det;
+
+        float tvx = packet->ox[k] - p1x;
+        float tvy = packet->oy[k] - p1y;
+        float tvz = packet->oz[k] - p1z;
+        float u = (tvx*px + tvy*py + tvz*pz)*invDet;
+
+        float qx = tvy*e1z - tvz*e1y;
+        float qy = tvz*e1x - tvx*e1z;
+        float qz = tvx*e1y - tvy*e1x;
+        float v = (packet->dx[k]*qx + packet->dy[k]*qy + packet->dz[k]*qz)*invDet;
+        float t = (e2x*qx + e2y*qy + e2z*qz)*invDet;
+
+        int hit = (fabsf(det) >= epsilon) & (u >= 0.0f) & (u <= 1.0f) & (v >= 0.0f) & ((u + v) <= 1.0f) & (t > epsilon) & (t < closest[k]);
+
+        closest[k] = hit? t : closest[k];
+        closestIndex[k] = hit? index : closestIndex[k];
+    }
+}
+
+// Batch job: rays vs sphere, same results as rlGetRayCollisionSphere() for hits
+static void RayBatchSphereJob(void *data, int start, int end)
+{
+    RayBatchJob *job = (RayBatchJob *)data;
+    RayPacket packet = { 0 };
+    float distance[RAY_PACKET_SIZE] = { 0 };
+    int hit[RAY_PACKET_SIZE] = { 0 };
+    int inside[RAY_PACKET_SIZE] = { 0 };
+
+    rlVector3 center = job->center;
+    float radius2 = job->radius*job->radius;
+
+    for (int i = start; i < end; i++)
+    {
+        int first = i*RAY_PACKET_SIZE;
+        int valid = LoadRayPacket(&packet, job->rays, job->count, first, NULL);
+
+        for (int k = 0; k < RAY_PACKET_SIZE; k++)
+        {
+            float px = center.x - packet.ox[k];
+            float py = center.y - packet.oy[k];
+            float pz = center.z - packet.oz[k];
+            float vector = px*packet.dx[k] + py*packet.dy[k] + pz*packet.dz[k];
+            float length2 = px*px + py*py + pz*pz;
+            float d = radius2 - (length2 - vector*vector);
+            float root = sqrtf(fmaxf(d, 0.0f));
+
+            hit[k] = (d >= 0.0f);
+            inside[k] = (length2 < radius2);
+            distance[k] = inside[k]? (vector + root) : (vector - root);
+        }
+
+        for (int k = 0; k < valid; k++)
+        {
+            rlRayCollision collision = { 0 };
+
+            if (hit[k])
+            {
+                rlRay ray = job->rays[first + k];
+
+                collision.hit = true;
+                collision.distance = distance[k];
+                collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance[k]));
+                collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+                if (inside[k]) collision.normal = Vector3Negate(collision.normal);
+            }
+
+            job->collisions[first + k] = collision;
+        }
+    }
+}
+
+// Batch job: rays vs box, same results as rlGetRayCollisionBox() for hits
+static void RayBatchBoxJob(void *data, int start, int end)
+{
+    RayBatchJob *job = (RayBatchJob *)data;
+    RayPacket packet = { 0 };
+    float distance[RAY_PACKET_SIZE] = { 0 };
+    int hit[RAY_PACKET_SIZE] = { 0 };
+    int inside[RAY_PACKET_SIZE] = { 0 };
+
+    rlBoundingBox box = job->box;
+
+    for (int i = start; i < end; i++)
+    {
+        int first = i*RAY_PACKET_SIZE;
+        int valid = LoadRayPacket(&packet, job->rays, job->count, first, NULL);
+
+        for (int k = 0; k < RAY_PACKET_SIZE; k++)
+        {
+            // NOTE: If ray origin is inside the box, ray is reversed (see rlGetRayCollisionBox())
+            inside[k] = (packet.ox[k] > box.min.x) & (packet.ox[k] < box.max.x) &
+                        (packet.oy[k] > box.min.y) & (packet.oy[k] < box.max.y) &
+                        (packet.oz[k] > box.min.z) & (packet.oz[k] < box.max.z);
+            float sign = inside[k]? -1.0f : 1.0f;
+
+            float ix = 1.0f/(packet.dx[k]*sign);
+            float iy = 1.0f/(packet.dy[k]*sign);
+            float iz = 1.0f/(packet.dz[k]*sign);
+            float t0 = (box.min.x - packet.ox[k])*ix;
+            float t1 = (box.max.x - packet.ox[k])*ix;
+            float t2 = (box.min.y - packet.oy[k])*iy;
+            float t3 = (box.max.y - packet.oy[k])*iy;
+            float t4 = (box.min.z - packet.oz[k])*iz;
+            float t5 = (box.max.z - packet.oz[k])*iz;
+            float tmin = fmaxf(fmaxf(fminf(t0, t1), fminf(t2, t3)), fminf(t4, t5));
+            float tmax = fminf(fminf(fmaxf(t0, t1), fmaxf(t2, t3)), fmaxf(t4, t5));
+
+            hit[k] = (tmax >= 0.0f) & (tmin <= tmax);
+            distance[k] = tmin*sign;
+        }
+
+        for (int k = 0; k < valid; k++)
+        {
+            rlRayCollision collision = { 0 };
+
+            if (hit[k])
+            {
+                rlRay ray = job->rays[first + k];
+
+                collision.hit = true;
+                collision.distance = distance[k];
+                collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance[k]));
+                collision.normal = GetRayCollisionBoxNormal(box, collision.point);
+                if (inside[k]) collision.normal = Vector3Negate(collision.normal);
+            }
+
+            job->collisions[first + k] = collision;
+        }
+    }
+}
+
+// Batch job: rays vs triangle, same results as rlGetRayCollisionTriangle()
+static void RayBatchTriangleJob(void *data, int start, int end)
+{
+    RayBatchJob *job = (RayBatchJob *)data;
+    RayPacket packet = { 0 };
+    float closest[RAY_PACKET_SIZE] = { 0 };
+    int closestIndex[RAY_PACKET_SIZE] = { 0 };
+
+    rlVector3 edge1 = { job->triangle[3] - job->triangle[0], job->triangle[4] - job->triangle[1], job->triangle[5] - job->triangle[2] };
+    rlVector3 edge2 = { job->triangle[6] - job->triangle[0], job->triangle[7] - job->triangle[1], job->triangle[8] - job->triangle[2] };
+    rlVector3 normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+
+    for (int i = start; i < end; i++)
+    {
+        int first = i*RAY_PACKET_SIZE;
+        int valid = LoadRayPacket(&packet, job->rays, job->count, first, NULL);
+
+        for (int k = 0; k < RAY_PACKET_SIZE; k++)
+        {
+            closest[k] = FLT_MAX;
+            closestIndex[k] = -1;
+        }
+
+        GetRayPacketTriangle(&packet, job->triangle, 0, closest, closestIndex);
+
+        for (int k = 0; k < valid; k++)
+        {
+            rlRayCollision collision = { 0 };
+
+            if (closestIndex[k] >= 0)
+            {
+                rlRay ray = job->rays[first + k];
+
+                collision.hit = true;
+                collision.distance = closest[k];
+                collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, closest[k]));
+                collision.normal = normal;
+            }
+
+            job->collisions[first + k] = collision;
+        }
+    }
+}
+
+// Batch job: rays vs mesh triangles (mesh space)
+static void RayBatchMeshJob(void *data, int start, int end)
+{
+    RayBatchJob *job = (RayBatchJob *)data;
+    RayPacket packet = { 0 };
+    float closest[RAY_PACKET_SIZE] = { 0 };
+    int closestIndex[RAY_PACKET_SIZE] = { 0 };
+    float triangle[9] = { 0 };
+
+    for (int i = start; i < end; i++)
+    {
+        int first = i*RAY_PACKET_SIZE;
+        int valid = LoadRayPacket(&packet, job->rays, job->count, first, &job->invTransform);
+
+        for (int k = 0; k < RAY_PACKET_SIZE; k++)
+        {
+            closest[k] = FLT_MAX;
+            closestIndex[k] = -1;
+        }
+
+        for (int t = 0; t < job->mesh.triangleCount; t++)
+        {
+            GetMeshTriangle(job->mesh, t, (rlVector3 *)&triangle[0], (rlVector3 *)&triangle[3], (rlVector3 *)&triangle[6]);
+            GetRayPacketTriangle(&packet, triangle, t, closest, closestIndex);
+        }
+
+        for (int k = 0; k < valid; k++)
+        {
+            rlRayCollision collision = { 0 };
+
+            if (closestIndex[k] >= 0)
+            {
+                GetMeshTriangle(job->mesh, closestIndex[k], (rlVector3 *)&triangle[0], (rlVector3 *)&triangle[3], (rlVector3 *)&triangle[6]);
+                collision = GetRayCollisionMeshHit(job->rays[first + k], triangle, closest[k], job->invTransform, job->mirrored);
+            }
+
+            job->collisions[first + k] = collision;
+        }
+    }
+}
+
+// Batch job: rays vs mesh BVH (mesh space)
+static void RayBatchMeshBVHJob(void *data, int start, int end)
+{
+    RayBatchJob *job = (RayBatchJob *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        rlRayCollision collision = { 0 };
+
+        if (job->bvh.nodeCount > 0)
+        {
+            float distance = 0.0f;
+            int triangle = GetRayBVHTriangle(job->bvh, GetRayMeshSpace(job->rays[i], job->invTransform), &distance);
+
+            if (triangle >= 0) collision = GetRayCollisionMeshHit(job->rays[i], &job->bvh.triangles[triangle*9], distance, job->invTransform, job->mirrored);
+        }
+
+        job->collisions[i] = collision;
+    }
+}
+
+// Update model meshes animated vertex data for pose (CPU skinning)
+// NOTE: Bones transforms are computed once, vertex blocks are skinned with parallel-for
+// jobs (job system or rlSetParallelForCallback()), updated data is uploaded to GPU
+static void UpdateModelSkinning(rlModel model, const rlTransform *pose, int boneCount)
+{
+    if (boneCount > model.boneCount) boneCount = model.boneCount;
+    if ((boneCount <= 0) || (model.bindPose == NULL)) return;
+
+    SkinningBone *bones = (SkinningBone *)RL_MALLOC(boneCount*sizeof(SkinningBone));
+
+    // Bone transform: animated rotation*scale applied to vertex relative to bind translation
+    // v' = rotation*(scale*(v - inTranslation)) + outTranslation, rotation = outRotation*inRotation^-1
+    for (int i = 0; i < boneCount; i++)
+    {
+        rlTransform in = model.bindPose[i];
+        rlTransform out = pose[i];
+
+        Quaternion rotation = QuaternionMultiply(out.rotation, QuaternionInvert(in.rotation));
+        rlVector3 axis[3] = {
+            Vector3RotateByQuaternion((rlVector3){ 1.0f, 0.0f, 0.0f }, rotation),
+            Vector3RotateByQuaternion((rlVector3){ 0.0f, 1.0f, 0.0f }, rotation),
+            Vector3RotateByQuaternion((rlVector3){ 0.0f, 0.0f, 1.0f }, rotation)
+        };
+        float scale[3] = { out.scale.x, out.scale.y, out.scale.z };
+
+        for (int r = 0; r < 3; r++)
+        {
+            float *row = &bones[i].position[r*4];
+            row[0] = ((float *)&axis[0])[r]*scale[0];
+            row[1] = ((float *)&axis[1])[r]*scale[1];
+            row[2] = ((float *)&axis[2])[r]*scale[2];
+            row[3] = ((float *)&out.translation)[r] - (row[0]*in.translation.x + row[1]*in.translation.y + row[2]*in.translation.z);
+
+            bones[i].normal[r*4] = ((float *)&axis[0])[r];
+            bones[i].normal[r*4 + 1] = ((float *)&axis[1])[r];
+            bones[i].normal[r*4 + 2] = ((float *)&axis[2])[r];
+            bones[i].normal[r*4 + 3] = 0.0f;
+        }
+    }
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        rlMesh mesh = model.meshes[m];
+
+        if ((mesh.boneIds == NULL) || (mesh.boneWeights == NULL))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: rlUpdateModelAnimation(): rlMesh %i has no connection to bones", m);
+            continue;
+        }
+
+        if ((mesh.animVertices == NULL) || (mesh.vertexCount <= 0)) continue;
+
+        SkinningJob job = { 0 };
+        job.mesh = mesh;
+        job.bones = bones;
+        job.boneCount = boneCount;
+
+        RunParallelFor(SkinMeshJob, &job, (mesh.vertexCount + SKINNING_BLOCK_SIZE - 1)/SKINNING_BLOCK_SIZE);
+
+        // Upload new vertex data to GPU for model drawing
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+        if (mesh.animNormals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+    }
+
+    RL_FREE(bones);
+}
+
+// Skinning job: mesh vertices (vertex blocks range)
+// NOTE: Bones transforms are blended per vertex (linear blend skinning, same result as blending
+// transformed vertices), fixed size blend loop is vectorized by compiler, then every vertex
+// is transformed once with its blended transform
+static void SkinMeshJob(void *data, int start, int end)
+{
+    SkinningJob *job = (SkinningJob *)data;
+    const rlMesh *mesh = &job->mesh;
+    bool skinNormals = (mesh->normals != NULL) && (mesh->animNormals != NULL);
+
+    float blend[24] = { 0 };
+
+    for (int block = start; block < end; block++)
+    {
+        int first = block*SKINNING_BLOCK_SIZE;
+        int last = first + SKINNING_BLOCK_SIZE;
+        if (last > mesh->vertexCount) last = mesh->vertexCount;
+
+        for (int i = first; i < last; i++)
+        {
+            // Blend bones transforms (up to 4 bones per vertex)
+            for (int c = 0; c < 24; c++) blend[c] = 0.0f;
+
+            for (int j = 0; j < 4; j++)
+            {
+                float weight = mesh->boneWeights[i*4 + j];
+                int boneId = mesh->boneIds[i*4 + j];
+
+                // Early stop when no transformation will be applied
+                if ((weight == 0.0f) || (boneId >= job->boneCount)) continue;
+
+                const float *bone = (const float *)&job->bones[boneId];
+                for (int c = 0; c < 24; c++) blend[c] += weight*bone[c];
+            }
+
+            // Vertices processing
+            // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
+            float x = mesh->vertices[i*3];
+            float y = mesh->vertices[i*3 + 1];
+            float z = mesh->vertices[i*3 + 2];
+            mesh->animVertices[i*3] = blend[0]*x + blend[1]*y + blend[2]*z + blend[3];
+            mesh->animVertices[i*3 + 1] = blend[4]*x + blend[5]*y + blend[6]*z + blend[7];
+            mesh->animVertices[i*3 + 2] = blend[8]*x + blend[9]*y + blend[10]*z + blend[11];
+
+            // Normals processing
+            // NOTE: We use meshes.normals (default normal) to calculate meshes.animNormals (animated normals)
+            if (skinNormals)
+            {
+                x = mesh->normals[i*3];
+                y = mesh->normals[i*3 + 1];
+                z = mesh->normals[i*3 + 2];
+                mesh->animNormals[i*3] = blend[12]*x + blend[13]*y + blend[14]*z;
+                mesh->animNormals[i*3 + 1] = blend[16]*x + blend[17]*y + blend[18]*z;
+                mesh->animNormals[i*3 + 2] = blend[20]*x + blend[21]*y + blend[22]*z;
+            }
+        }
+    }
+}
+
+// Update model meshes bone matrices for a pose (GPU skinning)
+static void UpdateModelBoneMatrices(rlModel model, const rlTransform *pose, int boneCount)
+{
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices)
+        {
+            assert(model.meshes[i].boneCount == boneCount);
+          
+            for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
+            {
+                rlVector3 inTranslation = model.bindPose[boneId].translation;
+                Quaternion inRotation = model.bindPose[boneId].rotation;
+                rlVector3 inScale = model.bindPose[boneId].scale;
+                
+                rlVector3 outTranslation = pose[boneId].translation;
+                Quaternion outRotation = pose[boneId].rotation;
+                rlVector3 outScale = pose[boneId].scale;
+
+                rlVector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
+                Quaternion invRotation = QuaternionInvert(inRotation);
+                rlVector3 invScale = Vector3Divide((rlVector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+                rlVector3 boneTranslation = Vector3Add(
+                    Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
+                    outRotation), outTranslation); 
+                Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
+                rlVector3 boneScale = Vector3Multiply(outScale, invScale);
+                
+                rlMatrix boneMatrix = MatrixMultiply(MatrixMultiply(
+                    QuaternionToMatrix(boneRotation),
+                    MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+                    MatrixScale(boneScale.x, boneScale.y, boneScale.z));
+                
+                model.meshes[i].boneMatrices[boneId] = boneMatrix;
+            }
+        }
+    }
+}
+
+// Get animation frames around a fractional frame (wraps around), returns interpolation amount
+static float GetAnimationFrames(rlModelAnimation anim, float frame, int *frame0, int *frame1)
+{
+    float wrapped = fmodf(frame, (float)anim.frameCount);
+    if (wrapped < 0.0f) wrapped += (float)anim.frameCount;
+
+    *frame0 = (int)wrapped;
+    if (*frame0 >= anim.frameCount) *frame0 = anim.frameCount - 1;
+    *frame1 = (*frame0 + 1)%anim.frameCount;
+
+    return wrapped - (float)(*frame0);
+}
+
+// Get interpolated transform: translation and scale lerp, rotation slerp
+static rlTransform GetTransformLerp(rlTransform t1, rlTransform t2, float amount)
+{
+    if (amount <= 0.0f) return t1;
+    if (amount >= 1.0f) return t2;
+
+    rlTransform result = { 0 };
+
+    result.translation = Vector3Lerp(t1.translation, t2.translation, amount);
+    result.rotation = QuaternionSlerp(t1.rotation, t2.rotation, amount);
+    result.scale = Vector3Lerp(t1.scale, t2.scale, amount);
+
+    return result;
+}
+
+// Get animation bone transform between two frames, compressed animations are sampled from keys
+static rlTransform GetAnimationTransform(rlModelAnimation anim, int frame0, int frame1, float amount, int bone)
+{
+    if (anim.keys == NULL) return GetTransformLerp(anim.framePoses[frame0][bone], anim.framePoses[frame1][bone], amount);
+
+    // Consecutive frames are sampled at once, keys already interpolate between them
+    if (frame1 == (frame0 + 1)) return GetAnimationKeysTransform(anim.keys, (float)frame0 + amount, bone);
+
+    return GetTransformLerp(GetAnimationKeysTransform(anim.keys, (float)frame0, bone), GetAnimationKeysTransform(anim.keys, (float)frame1, bone), amount);
+}
+
+// Get animation pose between two frames (anim.boneCount transforms)
+static void GetAnimationPose(rlModelAnimation anim, int frame0, int frame1, float amount, rlTransform *pose)
+{
+    for (int i = 0; i < anim.boneCount; i++) pose[i] = GetAnimationTransform(anim, frame0, frame1, amount, i);
+
+    if ((anim.keys != NULL) && anim.keys->local) BuildPoseFromParentJoints(anim.bones, anim.boneCount, pose);
+}
+
+// Get compressed animation bone transform at fractional frame (in range [0..frameCount - 1])
+static rlTransform GetAnimationKeysTransform(const rlAnimationKeys *keys, float frame, int bone)
+{
+    rlTransform result = { 0 };
+    const AnimationTrack *tracks = &keys->tracks[bone*3];
+    float amount = 0.0f;
+    float value[4] = { 0 };
+    float key1[4] = { 0 };
+    float key2[4] = { 0 };
+
+    int key = GetAnimationTrackKey(tracks[0], keys->vectorFrames, frame, &amount);
+    LerpAnimationKey(&keys->vectors[key*3], &keys->vectors[(key + ((amount > 0.0f)? 1 : 0))*3], amount, 3, value);
+    result.translation = (rlVector3){ value[0], value[1], value[2] };
+
+    key = GetAnimationTrackKey(tracks[1], keys->rotationFrames, frame, &amount);
+    DequantizeAnimationRotation(&keys->rotations[key*3], key1);
+    if (amount > 0.0f)
+    {
+        DequantizeAnimationRotation(&keys->rotations[(key + 1)*3], key2);
+        LerpAnimationKey(key1, key2, amount, 4, value);
+        result.rotation = (Quaternion){ value[0], value[1], value[2], value[3] };
+    }
+    else result.rotation = (Quaternion){ key1[0], key1[1], key1[2], key1[3] };
+
+    key = GetAnimationTrackKey(tracks[2], keys->vectorFrames, frame, &amount);
+    LerpAnimationKey(&keys->vectors[key*3], &keys->vectors[(key + ((amount > 0.0f)? 1 : 0))*3], amount, 3, value);
+    result.scale = (rlVector3){ value[0], value[1], value[2] };
+
+    return result;
+}
+
+// Get track key at or before frame (binary search), amount is interpolation towards next key
+static int GetAnimationTrackKey(AnimationTrack track, const float *frames, float frame, float *amount)
+{
+    int first = track.firstKey;
+    int last = track.firstKey + track.keyCount - 1;
+
+    *amount = 0.0f;
+
+    if ((track.keyCount == 1) || (frame <= (float)frames[first])) return first;
+    if (frame >= (float)frames[last]) return last;
+
+    while ((last - first) > 1)
+    {
+        int middle = (first + last)/2;
+
+        if ((float)frames[middle] <= frame) first = middle;
+        else last = middle;
+    }
+
+    *amount = (frame - (float)frames[first])/(float)(frames[last] - frames[first]);
+
+    return first;
+}
+
+// Quantize rotation (smallest three): largest component is dropped (made positive) and recomputed on
+// dequantization, other components are in range [-1/sqrt(2)..1/sqrt(2)] and stored with 15 bits,
+// largest component index is stored in first and second values higher bits
+static void QuantizeAnimationRotation(const float *rotation, unsigned short *quantized)
+{
+    int largest = 0;
+    for (int i = 1; i < 4; i++) if (fabsf(rotation[i]) > fabsf(rotation[largest])) largest = i;
+
+    float sign = (rotation[largest] < 0.0f)? -1.0f : 1.0f;
+
+    for (int i = 0, k = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        float value = (rotation[i]*sign*0.70710678f + 0.5f)*32767.0f + 0.5f;
+        if (value < 0.0f) value = 0.0f;
+        else if (value > 32767.0f) value = 32767.0f;
+
+        quantized[k] = (unsigned short)value;
+        k++;
+    }
+
+    quantized[0] |= (unsigned short)((largest & 1) << 15);
+    quantized[1] |= (unsigned short)((largest >> 1) << 15);
+}
+
+// Dequantize rotation (smallest three)
+static void DequantizeAnimationRotation(const unsigned short *quantized, float *rotation)
+{
+    int largest = (quantized[0] >> 15) | ((quantized[1] >> 15) << 1);
+    float sum = 0.0f;
+
+    for (int i = 0, k = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        rotation[i] = ((float)(quantized[k] & 0x7fff)/32767.0f - 0.5f)*1.41421356f;
+        sum += rotation[i]*rotation[i];
+        k++;
+    }
+
+    rotation[largest] = (sum < 1.0f)? sqrtf(1.0f - sum) : 0.0f;
+}
+
+// Interpolate keys values, rotations (4 components) are interpolated on shortest path (slerp)
+static void LerpAnimationKey(const float *key1, const float *key2, float amount, int components, float *result)
+{
+    if (components == 4)
+    {
+        Quaternion q = QuaternionSlerp((Quaternion){ key1[0], key1[1], key1[2], key1[3] }, (Quaternion){ key2[0], key2[1], key2[2], key2[3] }, amount);
+
+        result[0] = q.x;
+        result[1] = q.y;
+        result[2] = q.z;
+        result[3] = q.w;
+    }
+    else
+    {
+        for (int i = 0; i < components; i++) result[i] = key1[i] + amount*(key2[i] - key1[i]);
+    }
+}
+
+// Get track keyframes, frames are removed while interpolated keys error stays within tolerance
+// NOTE: values are source values and decoded are values stored in keys (quantized rotations)
+static int ReduceAnimationTrack(const float *values, const float *decoded, int frameCount, int components, float tolerance, int *keyFrames)
+{
+    int keyCount = 0;
+    float value[4] = { 0 };
+
+    keyFrames[keyCount++] = 0;
+
+    // Constant track, first key is used for all frames
+    bool constant = true;
+    for (int f = 1; (f < frameCount) && constant; f++) constant = (GetAnimationKeyError(decoded, &values[f*components], components) <= tolerance);
+
+    if (constant) return keyCount;
+
+    // Keys are extended while removed frames can be interpolated within tolerance,
+    // keys span is limited to bound reduction cost
+    int key = 0;
+
+    while (key < (frameCount - 1))
+    {
+        int nextKey = key + 1;
+
+        for (int end = key + 2; (end < frameCount) && ((end - key) <= ANIMATION_KEYS_MAX_SPAN); end++)
+        {
+            bool valid = true;
+
+            for (int f = key + 1; (f < end) && valid; f++)
+            {
+                LerpAnimationKey(&decoded[key*components], &decoded[end*components], (float)(f - key)/(float)(end - key), components, value);
+                valid = (GetAnimationKeyError(value, &values[f*components], components) <= tolerance);
+            }
+
+            if (!valid) break;
+            nextKey = end;
+        }
+
+        keyFrames[keyCount++] = nextKey;
+        key = nextKey;
+    }
+
+    return keyCount;
+}
+
+// Get key value maximum component error, rotations (4 components) sign is ignored
+static float GetAnimationKeyError(const float *value, const float *source, int components)
+{
+    float sign = 1.0f;
+    float error = 0.0f;
+
+    if (components == 4) sign = ((value[0]*source[0] + value[1]*source[1] + value[2]*source[2] + value[3]*source[3]) < 0.0f)? -1.0f : 1.0f;
+
+    for (int i = 0; i < components; i++) error = fmaxf(error, fabsf(sign*value[i] - source[i]));
+
+    return error;
+}
+
+// Get compressed animation keyframes memory size (bytes)
+static int GetAnimationKeysSize(const rlAnimationKeys *keys)
+{
+    int size = (int)sizeof(rlAnimationKeys) + keys->boneCount*3*(int)sizeof(AnimationTrack);
+
+    size += keys->vectorKeyCount*(int)(4*sizeof(float));
+    size += keys->rotationKeyCount*(int)(sizeof(float) + 3*sizeof(unsigned short));
+
+    return size;
+}
+
+// Get free tree node, free nodes are reused first
+static int AllocateAABBTreeNode(rlAABBTree *tree)
+{
+    int node = tree->freeNode;
+
+    if (node >= 0) tree->freeNode = tree->nodes[node].parent;
+    else
+    {
+        if (tree->nodeCount == tree->nodeCapacity)
+        {
+            tree->nodeCapacity *= 2;
+            tree->nodes = (AABBTreeNode *)RL_REALLOC(tree->nodes, tree->nodeCapacity*sizeof(AABBTreeNode));
+        }
+
+        node = tree->nodeCount;
+        tree->nodeCount++;
+    }
+
+    tree->nodes[node].parent = -1;
+    tree->nodes[node].child1 = -1;
+    tree->nodes[node].child2 = -1;
+    tree->nodes[node].height = 0;
+
+    return node;
+}
+
+// Free tree node, linked to free nodes list through parent
+static void FreeAABBTreeNode(rlAABBTree *tree, int node)
+{
+    tree->nodes[node].parent = tree->freeNode;
+    tree->nodes[node].height = -1;
+    tree->freeNode = node;
+}
+
+// Insert leaf node in tree
+// NOTE: Sibling is selected descending the tree by lowest surface area cost (SAH)
+static void InsertAABBTreeLeaf(rlAABBTree *tree, int leaf)
+{
+    if (tree->root == -1)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
+
+    rlBoundingBox leafBox = tree->nodes[leaf].box;
+    int index = tree->root;
+
+    while (tree->nodes[index].height > 0)
+    {
+        const AABBTreeNode *node = &tree->nodes[index];
+
+        float area = GetBoundingBoxArea(node->box);
+        float combinedArea = GetBoundingBoxArea(GetBoundingBoxUnion(node->box, leafBox));
+
+        // Cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f*combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f*(combinedArea - area);
+
+        const AABBTreeNode *child1 = &tree->nodes[node->child1];
+        const AABBTreeNode *child2 = &tree->nodes[node->child2];
+        float cost1 = GetBoundingBoxArea(GetBoundingBoxUnion(child1->box, leafBox)) + inheritanceCost;
+        float cost2 = GetBoundingBoxArea(GetBoundingBoxUnion(child2->box, leafBox)) + inheritanceCost;
+        if (child1->height > 0) cost1 -= GetBoundingBoxArea(child1->box);
+        if (child2->height > 0) cost2 -= GetBoundingBoxArea(child2->box);
+
+        if ((cost < cost1) && (cost < cost2)) break;
+
+        index = (cost1 < cost2)? node->child1 : node->child2;
+    }
+
+    // Create new parent for sibling and leaf
+    int sibling = index;
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateAABBTreeNode(tree);
+
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].box = GetBoundingBoxUnion(leafBox, tree->nodes[sibling].box);
+    tree->nodes[newParent].height = tree->nodes[sibling].height + 1;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    if (oldParent != -1)
+    {
+        if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+        else tree->nodes[oldParent].child2 = newParent;
+    }
+    else tree->root = newParent;
+
+    UpdateAABBTreeAncestors(tree, tree->nodes[leaf].parent);
+}
+
+// Remove leaf node from tree, leaf parent node is freed
+static void RemoveAABBTreeLeaf(rlAABBTree *tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = -1;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    if (grandParent != -1)
+    {
+        if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+        else tree->nodes[grandParent].child2 = sibling;
+
+        tree->nodes[sibling].parent = grandParent;
+        FreeAABBTreeNode(tree, parent);
+
+        UpdateAABBTreeAncestors(tree, grandParent);
+    }
+    else
+    {
+        tree->root = sibling;
+        tree->nodes[sibling].parent = -1;
+        FreeAABBTreeNode(tree, parent);
+    }
+}
+
+// Balance and refit nodes from node to root
+static void UpdateAABBTreeAncestors(rlAABBTree *tree, int node)
+{
+    int index = node;
+
+    while (index != -1)
+    {
+        index = BalanceAABBTreeNode(tree, index);
+
+        AABBTreeNode *current = &tree->nodes[index];
+        const AABBTreeNode *child1 = &tree->nodes[current->child1];
+        const AABBTreeNode *child2 = &tree->nodes[current->child2];
+
+        current->height = 1 + ((child1->height > child2->height)? child1->height : child2->height);
+        current->box = GetBoundingBoxUnion(child1->box, child2->box);
+
+        index = current->parent;
+    }
+}
+
+// Balance tree node with a rotation if children heights differ by more than one
+// NOTE: Taller child grandchild is rotated up, returns new subtree root
+static int BalanceAABBTreeNode(rlAABBTree *tree, int node)
+{
+    AABBTreeNode *a = &tree->nodes[node];
+    if (a->height < 2) return node;
+
+    int indexB = a->child1;
+    int indexC = a->child2;
+    int balance = tree->nodes[indexC].height - tree->nodes[indexB].height;
+
+    if ((balance >= -1) && (balance <= 1)) return node;
+
+    // Rotate taller child (up) with its parent (down)
+    int indexUp = (balance > 1)? indexC : indexB;
+    int indexOther = (balance > 1)? indexB : indexC;
+    AABBTreeNode *up = &tree->nodes[indexUp];
+    int indexF = up->child1;
+    int indexG = up->child2;
+    AABBTreeNode *f = &tree->nodes[indexF];
+    AABBTreeNode *g = &tree->nodes[indexG];
+
+    up->child1 = node;
+    up->parent = a->parent;
+    a->parent = indexUp;
+
+    if (up->parent != -1)
+    {
+        if (tree->nodes[up->parent].child1 == node) tree->nodes[up->parent].child1 = indexUp;
+        else tree->nodes[up->parent].child2 = indexUp;
+    }
+    else tree->root = indexUp;
+
+    // Taller grandchild stays with rotated up node, shorter one moves to node
+    int indexKeep = (f->height > g->height)? indexF : indexG;
+    int indexMove = (f->height > g->height)? indexG : indexF;
+    AABBTreeNode *keep = &tree->nodes[indexKeep];
+    AABBTreeNode *move = &tree->nodes[indexMove];
+    const AABBTreeNode *other = &tree->nodes[indexOther];
+
+    up->child2 = indexKeep;
+    if (balance > 1) a->child2 = indexMove;
+    else a->child1 = indexMove;
+    move->parent = node;
+
+    a->box = GetBoundingBoxUnion(other->box, move->box);
+    a->height = 1 + ((other->height > move->height)? other->height : move->height);
+    up->box = GetBoundingBoxUnion(a->box, keep->box);
+    up->height = 1 + ((a->height > keep->height)? a->height : keep->height);
+
+    return indexUp;
+}
+
+// Get bounding box enclosing both boxes
+static rlBoundingBox GetBoundingBoxUnion(rlBoundingBox box1, rlBoundingBox box2)
+{
+    rlBoundingBox box = { Vector3Min(box1.min, box2.min), Vector3Max(box1.max, box2.max) };
+
+    return box;
+}
+
+// Get bounding box surface area (half, only used to compare costs)
+static float GetBoundingBoxArea(rlBoundingBox box)
+{
+    rlVector3 size = Vector3Subtract(box.max, box.min);
+
+    return size.x*size.y + size.y*size.z + size.z*size.x;
+}
+
+// Check if box is inside or intersecting frustum planes
+// NOTE: Box corner farthest along every plane normal is tested, planes are not normalized
+static bool CheckCollisionBoxFrustum(rlBoundingBox box, const float *planes)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        const float *plane = &planes[i*4];
+        float x = (plane[0] >= 0.0f)? box.max.x : box.min.x;
+        float y = (plane[1] >= 0.0f)? box.max.y : box.min.y;
+        float z = (plane[2] >= 0.0f)? box.max.z : box.min.z;
+
+        if ((plane[0]*x + plane[1]*y + plane[2]*z + plane[3]) < 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Build pose from parent joints
+// NOTE: Required for animations loading (IQM and GLTF) and parent relative animation keys sampling
+static void BuildPoseFromParentJoints(rlBoneInfo *bones, int boneCount, rlTransform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
             transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
             transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
             transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
         }
     }
 }
-#endif
+
+// Build pose to parent joints, inverse of BuildPoseFromParentJoints()
+// NOTE: Bones are converted in reverse order, parents are still in model space when converting their children
+static void BuildPoseToParentJoints(rlBoneInfo *bones, int boneCount, rlTransform *transforms)
+{
+    for (int i = boneCount - 1; i >= 0; i--)
+    {
+        if ((bones[i].parent >= 0) && (bones[i].parent < i))
+        {
+            rlTransform parent = transforms[bones[i].parent];
+            Quaternion invRotation = QuaternionInvert(parent.rotation);
+
+            transforms[i].translation = Vector3RotateByQuaternion(Vector3Subtract(transforms[i].translation, parent.translation), invRotation);
+            transforms[i].rotation = QuaternionMultiply(invRotation, transforms[i].rotation);
+            transforms[i].scale = Vector3Divide(transforms[i].scale, parent.scale);
+        }
+    }
+}
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
@@ -4220,20 +7019,16 @@ static rlModel LoadOBJ(const char *fileName)
     rlModel model = { 0 };
     model.transform = MatrixIdentity();
 
-    char* fileText = rlLoadFileText(fileName);
+    // NOTE: Material library and textures paths are relative to OBJ directory, working directory is not changed
+    char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    GetModelDirectoryPath(fileName, dirPath);
+
+    char* fileText = LoadFileTextOBJ(fileName, dirPath);
 
     if (fileText == NULL)
     {
         TRACELOG(LOG_ERROR, "MODEL Unable to read obj file %s", fileName);
-        return model;
-    }
-
-    char currentDir[1024] = { 0 };
-    strcpy(currentDir, rlGetWorkingDirectory()); // Save current working directory
-    const char* workingDir = rlGetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-    if (CHDIR(workingDir) != 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+        return model;
     }
 
     unsigned int dataSize = (unsigned int)strlen(fileText);
@@ -4241,14 +7036,14 @@ static rlModel LoadOBJ(const char *fileName)
     unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
     int ret = tinyobj_parse_obj(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags);
 
+    rlUnloadFileText(fileText);
+
     if (ret != TINYOBJ_SUCCESS)
     {
         TRACELOG(LOG_ERROR, "MODEL Unable to read obj data %s", fileName);
         return model;
     }
 
-    rlUnloadFileText(fileText);
-
     unsigned int faceVertIndex = 0;
     unsigned int nextShape = 1;
     int lastMaterial = -1;
@@ -4426,23 +7221,54 @@ static rlModel LoadOBJ(const char *fileName)
         }
     }
 
-    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount);
+    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount, dirPath);
     else model.materials[0] = rlLoadMaterialDefault(); // Set default material for the mesh
 
     tinyobj_attrib_free(&objAttributes);
     tinyobj_shapes_free(objShapes, objShapeCount);
     tinyobj_materials_free(objMaterials, objMaterialCount);
 
-    for (int i = 0; i < model.meshCount; i++)
-        rlUploadMesh(model.meshes + i, true);
+    return model;
+}
 
-    // Restore current working directory
-    if (CHDIR(currentDir) != 0)
+// Load OBJ file text, material library path is made relative to OBJ directory
+// NOTE: tinyobj opens material library relative to working directory, path is rewritten
+// instead of changing working directory, so loading is safe on worker threads
+static char *LoadFileTextOBJ(const char *fileName, const char *dirPath)
+{
+    char *text = rlLoadFileText(fileName);
+    if (text == NULL) return NULL;
+
+    // Find material library name, last "mtllib" line is used (as tinyobj does)
+    char *libName = NULL;
+    for (char *line = text; (line != NULL) && (*line != '\0'); )
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        char *token = line;
+        while ((*token == ' ') || (*token == '\t')) token++;
+        if ((strncmp(token, "mtllib", 6) == 0) && ((token[6] == ' ') || (token[6] == '\t'))) libName = token + 7;
+
+        line = strchr(line, '\n');
+        if (line != NULL) line++;
     }
 
-    return model;
+    if (libName == NULL) return text;
+
+    while ((*libName == ' ') || (*libName == '\t')) libName++;
+    if ((libName[0] == '/') || (libName[0] == '\\') || ((libName[0] != '\0') && (libName[1] == ':'))) return text;
+
+    // Insert OBJ directory before material library name
+    int offset = (int)(libName - text);
+    int dirLength = (int)strlen(dirPath);
+    char *result = (char *)RL_MALLOC(strlen(text) + dirLength + 2);
+
+    memcpy(result, text, offset);
+    memcpy(result + offset, dirPath, dirLength);
+    result[offset + dirLength] = '/';
+    strcpy(result + offset + dirLength + 1, libName);
+
+    rlUnloadFileText(text);
+
+    return result;
 }
 #endif
 
@@ -4561,7 +7387,9 @@ static rlModel LoadIQM(const char *fileName)
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return model;
 
-    const char *basePath = rlGetDirectoryPath(fileName);
+    char basePath[MAX_FILEPATH_LENGTH] = { 0 };
+    char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+    GetModelDirectoryPath(fileName, basePath);
 
     // Read IQM header
     IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
@@ -4607,7 +7435,7 @@ static rlModel LoadIQM(const char *fileName)
         memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
         model.materials[i] = rlLoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(rlTextFormat("%s/%s", basePath, material));
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadModelTextureFile(GetModelFilePath(texPath, basePath, material));
 
         model.meshMaterial[i] = i;
 
@@ -4912,7 +7740,7 @@ static rlModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animC
     //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
     memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
 
-    rlModelAnimation *animations = RL_MALLOC(iqmHeader->num_anims*sizeof(rlModelAnimation));
+    rlModelAnimation *animations = RL_CALLOC(iqmHeader->num_anims, sizeof(rlModelAnimation));
 
     // frameposes
     unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
@@ -5128,7 +7956,8 @@ static rlImage LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texP
         }
         else     // Check if image is provided as image path
         {
-            image = rlLoadImage(rlTextFormat("%s/%s", texPath, cgltfImage->uri));
+            char imagePath[MAX_FILEPATH_LENGTH] = { 0 };
+            image = rlLoadImage(GetModelFilePath(imagePath, texPath, cgltfImage->uri));
         }
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
@@ -5150,7 +7979,7 @@ static rlImage LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texP
             (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = rlLoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = rlLoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", rlTextFormat("%s/%s", texPath, cgltfImage->uri));
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
         RL_FREE(data);
     }
@@ -5306,10 +8135,12 @@ static rlModel LoadGLTF(const char *fileName)
 
         // Load materials data
         //----------------------------------------------------------------------------------------------------
+        char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetModelDirectoryPath(fileName, texPath);
+
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = rlLoadMaterialDefault();
-            const char *texPath = rlGetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5321,7 +8152,7 @@ static rlModel LoadGLTF(const char *fileName)
                     rlImage imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
                     if (imAlbedo.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = rlLoadTextureFromImage(imAlbedo);
+                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadModelTexture(imAlbedo);
                         rlUnloadImage(imAlbedo);
                     }
                 }
@@ -5337,7 +8168,7 @@ static rlModel LoadGLTF(const char *fileName)
                     rlImage imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
                     if (imMetallicRoughness.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = rlLoadTextureFromImage(imMetallicRoughness);
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTexture(imMetallicRoughness);
                         rlUnloadImage(imMetallicRoughness);
                     }
 
@@ -5355,7 +8186,7 @@ static rlModel LoadGLTF(const char *fileName)
                     rlImage imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
                     if (imNormal.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = rlLoadTextureFromImage(imNormal);
+                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTexture(imNormal);
                         rlUnloadImage(imNormal);
                     }
                 }
@@ -5366,7 +8197,7 @@ static rlModel LoadGLTF(const char *fileName)
                     rlImage imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
                     if (imOcclusion.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = rlLoadTextureFromImage(imOcclusion);
+                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTexture(imOcclusion);
                         rlUnloadImage(imOcclusion);
                     }
                 }
@@ -5377,7 +8208,7 @@ static rlModel LoadGLTF(const char *fileName)
                     rlImage imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
                     if (imEmissive.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = rlLoadTextureFromImage(imEmissive);
+                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTexture(imEmissive);
                         rlUnloadImage(imEmissive);
                     }
 
@@ -5929,30 +8760,40 @@ static rlModel LoadGLTF(const char *fileName)
 }
 
 // Get interpolated pose for bone sampler at a specific time. Returns true on success
-static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+// NOTE: Sampler input key times are read once (times), cursor is the key found by previous call:
+// it is moved forward for increasing times and binary search is used when time goes backwards
+static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, const float *times, int timeCount, cgltf_accessor *output, float time, int *cursor, void *data)
 {
-    if (interpolationType >= cgltf_interpolation_type_max_enum) return false;
+    if ((interpolationType >= cgltf_interpolation_type_max_enum) || (times == NULL) || (timeCount <= 0)) return false;
 
     // Input and output should have the same count
-    float tstart = 0.0f;
-    float tend = 0.0f;
-    int keyframe = 0;       // Defaults to first pose
+    int keyframe = *cursor;       // Defaults to first pose
 
-    for (int i = 0; i < (int)input->count - 1; i++)
+    if ((keyframe < 0) || (keyframe >= timeCount) || (time < times[keyframe]))
     {
-        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
-        if (!r1) return false;
-
-        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
-        if (!r2) return false;
+        // Binary search for last key time not greater than time
+        int first = 0;
+        int last = timeCount;
 
-        if ((tstart <= time) && (time < tend))
+        while ((last - first) > 1)
         {
-            keyframe = i;
-            break;
+            int middle = (first + last)/2;
+
+            if (times[middle] <= time) first = middle;
+            else last = middle;
         }
+
+        keyframe = first;
     }
 
+    while ((keyframe < (timeCount - 2)) && (times[keyframe + 1] <= time)) keyframe++;
+    if (keyframe > (timeCount - 2)) keyframe = (timeCount > 1)? (timeCount - 2) : 0;
+
+    *cursor = keyframe;
+
+    float tstart = times[keyframe];
+    float tend = (timeCount > 1)? times[keyframe + 1] : tstart;
+
     // Constant animation, no need to interpolate
     if (FloatEquals(tend, tstart)) return true;
 
@@ -6065,6 +8906,101 @@ static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_
 
 #define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
+#if defined(SUPPORT_GLTF_ANIMATION_KEYS)
+// Add key to animation keys arrays (rotations are quantized), keys arrays are expected to have space for it
+static void AddAnimationKeyGLTF(rlAnimationKeys *keys, int components, float frame, const float *value)
+{
+    if (components == 4)
+    {
+        Quaternion q = QuaternionNormalize((Quaternion){ value[0], value[1], value[2], value[3] });
+
+        keys->rotationFrames[keys->rotationKeyCount] = frame;
+        QuantizeAnimationRotation((float *)&q, &keys->rotations[keys->rotationKeyCount*3]);
+        keys->rotationKeyCount++;
+    }
+    else
+    {
+        keys->vectorFrames[keys->vectorKeyCount] = frame;
+        memcpy(&keys->vectors[keys->vectorKeyCount*3], value, 3*sizeof(float));
+        keys->vectorKeyCount++;
+    }
+}
+
+// Load glTF animation channel as animation track keys, keys arrays are expected to have space for channel keys
+// NOTE: Linear keys are kept as they are, step keys are held until next key time (duplicated key) and
+// cubic spline channels are sampled every frame and reduced within ANIMATION_COMPRESSION_TOLERANCE
+static AnimationTrack LoadAnimationTrackGLTF(rlAnimationKeys *keys, cgltf_animation_channel *channel, const float *times, int timeCount, int components, const float *defaultValue)
+{
+    AnimationTrack track = { 0 };
+    track.firstKey = (components == 4)? keys->rotationKeyCount : keys->vectorKeyCount;
+
+    if ((channel == NULL) || (times == NULL) || (timeCount <= 0))
+    {
+        // No channel for bone transform component, joint transform is used
+        AddAnimationKeyGLTF(keys, components, 0.0f, defaultValue);
+        track.keyCount = 1;
+
+        return track;
+    }
+
+    cgltf_interpolation_type interpolation = channel->sampler->interpolation;
+
+    if (interpolation == cgltf_interpolation_type_cubic_spline)
+    {
+        float *values = (float *)RL_MALLOC(keys->frameCount*4*sizeof(float));
+        float *decoded = (float *)RL_MALLOC(keys->frameCount*4*sizeof(float));
+        int *keyFrames = (int *)RL_MALLOC(keys->frameCount*sizeof(int));
+        int cursor = 0;
+
+        for (int f = 0; f < keys->frameCount; f++)
+        {
+            float *value = &values[f*components];
+            memcpy(value, defaultValue, components*sizeof(float));
+
+            GetPoseAtTimeGLTF(interpolation, times, timeCount, channel->sampler->output, ((float)f*GLTF_ANIMDELAY)/1000.0f, &cursor, value);
+
+            if (components == 4)
+            {
+                unsigned short quantized[3] = { 0 };
+                Quaternion q = QuaternionNormalize((Quaternion){ value[0], value[1], value[2], value[3] });
+
+                memcpy(value, &q, 4*sizeof(float));
+                QuantizeAnimationRotation(value, quantized);
+                DequantizeAnimationRotation(quantized, &decoded[f*4]);
+            }
+        }
+
+        track.keyCount = ReduceAnimationTrack(values, (components == 4)? decoded : values, keys->frameCount, components, ANIMATION_COMPRESSION_TOLERANCE, keyFrames);
+
+        for (int k = 0; k < track.keyCount; k++) AddAnimationKeyGLTF(keys, components, (float)keyFrames[k], &values[keyFrames[k]*components]);
+
+        RL_FREE(values);
+        RL_FREE(decoded);
+        RL_FREE(keyFrames);
+    }
+    else
+    {
+        float value[4] = { 0 };
+
+        for (int k = 0; k < timeCount; k++)
+        {
+            cgltf_accessor_read_float(channel->sampler->output, k, value, components);
+
+            AddAnimationKeyGLTF(keys, components, times[k]*1000.0f/GLTF_ANIMDELAY, value);
+            track.keyCount++;
+
+            if ((interpolation == cgltf_interpolation_type_step) && (k < (timeCount - 1)))
+            {
+                AddAnimationKeyGLTF(keys, components, times[k + 1]*1000.0f/GLTF_ANIMDELAY, value);
+                track.keyCount++;
+            }
+        }
+    }
+
+    return track;
+}
+#endif
+
 static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
     // glTF file loading
@@ -6096,7 +9032,7 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
         {
             cgltf_skin skin = data->skins[0];
             *animCount = (int)data->animations_count;
-            animations = RL_MALLOC(data->animations_count*sizeof(rlModelAnimation));
+            animations = RL_CALLOC(data->animations_count, sizeof(rlModelAnimation));
 
             for (unsigned int i = 0; i < data->animations_count; i++)
             {
@@ -6109,6 +9045,9 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
                     cgltf_animation_channel *rotate;
                     cgltf_animation_channel *scale;
                     cgltf_interpolation_type interpolationType;
+                    float *times[3];        // Channels key times, read once (translate, rotate, scale)
+                    int timeCount[3];       // Channels key times count
+                    int cursor[3];          // Channels last sampled key (frames are sampled in order)
                 };
 
                 struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
@@ -6176,6 +9115,72 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
                 }
 
                 animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    cgltf_animation_channel *channels[3] = { boneChannels[k].translate, boneChannels[k].rotate, boneChannels[k].scale };
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        if (channels[c] == NULL) continue;
+
+                        cgltf_accessor *input = channels[c]->sampler->input;
+                        boneChannels[k].times[c] = (float *)RL_MALLOC(input->count*sizeof(float));
+                        boneChannels[k].timeCount[c] = (int)cgltf_accessor_unpack_floats(input, boneChannels[k].times[c], input->count);
+                    }
+                }
+
+#if defined(SUPPORT_GLTF_ANIMATION_KEYS)
+                // Keep channels keys (parent bone relative), sampled on animation update
+                rlAnimationKeys *keys = (rlAnimationKeys *)RL_CALLOC(1, sizeof(rlAnimationKeys));
+                keys->frameCount = animations[i].frameCount;
+                keys->boneCount = animations[i].boneCount;
+                keys->local = true;
+                keys->tracks = (AnimationTrack *)RL_MALLOC(keys->boneCount*3*sizeof(AnimationTrack));
+
+                // Keys arrays are allocated for the worst case and shrinked at the end
+                int vectorCapacity = 0;
+                int rotationCapacity = 0;
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    cgltf_animation_channel *channels[3] = { boneChannels[k].translate, boneChannels[k].rotate, boneChannels[k].scale };
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        int capacity = 1;
+
+                        if ((channels[c] != NULL) && (channels[c]->sampler->interpolation == cgltf_interpolation_type_cubic_spline)) capacity = keys->frameCount;
+                        else if (channels[c] != NULL) capacity += 2*boneChannels[k].timeCount[c];
+
+                        if (c == 1) rotationCapacity += capacity;
+                        else vectorCapacity += capacity;
+                    }
+                }
+
+                keys->vectorFrames = (float *)RL_MALLOC(vectorCapacity*sizeof(float));
+                keys->vectors = (float *)RL_MALLOC(vectorCapacity*3*sizeof(float));
+                keys->rotationFrames = (float *)RL_MALLOC(rotationCapacity*sizeof(float));
+                keys->rotations = (unsigned short *)RL_MALLOC(rotationCapacity*3*sizeof(unsigned short));
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    keys->tracks[k*3] = LoadAnimationTrackGLTF(keys, boneChannels[k].translate, boneChannels[k].times[0], boneChannels[k].timeCount[0], 3, skin.joints[k]->translation);
+                    keys->tracks[k*3 + 1] = LoadAnimationTrackGLTF(keys, boneChannels[k].rotate, boneChannels[k].times[1], boneChannels[k].timeCount[1], 4, skin.joints[k]->rotation);
+                    keys->tracks[k*3 + 2] = LoadAnimationTrackGLTF(keys, boneChannels[k].scale, boneChannels[k].times[2], boneChannels[k].timeCount[2], 3, skin.joints[k]->scale);
+                }
+
+                keys->vectorFrames = (float *)RL_REALLOC(keys->vectorFrames, keys->vectorKeyCount*sizeof(float));
+                keys->vectors = (float *)RL_REALLOC(keys->vectors, keys->vectorKeyCount*3*sizeof(float));
+                keys->rotationFrames = (float *)RL_REALLOC(keys->rotationFrames, keys->rotationKeyCount*sizeof(float));
+                keys->rotations = (unsigned short *)RL_REALLOC(keys->rotations, keys->rotationKeyCount*3*sizeof(unsigned short));
+
+                animations[i].keys = keys;
+
+                int posesSize = keys->frameCount*(keys->boneCount*(int)sizeof(rlTransform) + (int)sizeof(rlTransform *));
+                TRACELOG(LOG_INFO, "MODEL: [%s] Animation keyframes kept: %i KB (%i KB saved, %i keys)", animations[i].name,
+                    GetAnimationKeysSize(keys)/1024, (posesSize - GetAnimationKeysSize(keys))/1024, keys->vectorKeyCount + keys->rotationKeyCount);
+#else
                 animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(rlTransform *));
 
                 for (int j = 0; j < animations[i].frameCount; j++)
@@ -6191,7 +9196,7 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
 
                         if (boneChannels[k].translate)
                         {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].times[0], boneChannels[k].timeCount[0], boneChannels[k].translate->sampler->output, time, &boneChannels[k].cursor[0], &translation))
                             {
                                 TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
                             }
@@ -6199,7 +9204,7 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
 
                         if (boneChannels[k].rotate)
                         {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].times[1], boneChannels[k].timeCount[1], boneChannels[k].rotate->sampler->output, time, &boneChannels[k].cursor[1], &rotation))
                             {
                                 TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
                             }
@@ -6207,7 +9212,7 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
 
                         if (boneChannels[k].scale)
                         {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].times[2], boneChannels[k].timeCount[2], boneChannels[k].scale->sampler->output, time, &boneChannels[k].cursor[2], &scale))
                             {
                                 TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
                             }
@@ -6222,6 +9227,12 @@ static rlModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *anim
 
                     BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
                 }
+#endif
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    for (int c = 0; c < 3; c++) RL_FREE(boneChannels[k].times[c]);
+                }
 
                 TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (animData.name != NULL)? animData.name : "NULL", animations[i].frameCount, animDuration);
                 RL_FREE(boneChannels);
@@ -6615,12 +9626,12 @@ static rlModel LoadM3D(const char *fileName)
 
                             switch (prop->type)
                             {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = rlLoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = rlLoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = rlLoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = rlLoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = rlLoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = rlLoadTextureFromImage(image); break;
+                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTexture(image); break;
                                 default: break;
                             }
                         }
@@ -6735,7 +9746,7 @@ static rlModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animC
             return NULL;
         }
 
-        animations = RL_MALLOC(m3d->numaction*sizeof(rlModelAnimation));
+        animations = RL_CALLOC(m3d->numaction, sizeof(rlModelAnimation));
         *animCount = m3d->numaction;
 
         for (unsigned int a = 0; a < m3d->numaction; a++)
@@ -6813,4 +9824,343 @@ static rlModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animC
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// Load RMDL model data
+// NOTE: File is memory mapped, sections data is copied into model arrays with no parsing,
+// textures are created directly from mapped pixel data
+static rlModel LoadRMDL(const char *fileName)
+{
+    rlModel model = { 0 };
+
+    int dataSize = 0;
+    bool mapped = false;
+    unsigned char *fileData = LoadFileMapped(fileName, &dataSize, &mapped);
+
+    if (fileData == NULL) return model;
+
+    const RMDLModel *info = NULL;
+    if (IsDataValidRMDL(fileData, dataSize, fileName)) info = (const RMDLModel *)GetSectionRMDL(fileData, RMDL_SECTION_MODEL, 0, sizeof(RMDLModel));
+
+    // Counts are checked before allocating: every element requires at least its info section in file
+    if ((info != NULL) && (!IsCountValidRMDL(info->meshCount, sizeof(RMDLMesh), dataSize) ||
+        !IsCountValidRMDL(info->materialCount, sizeof(RMDLMaterial), dataSize) ||
+        !IsCountValidRMDL(info->textureCount, sizeof(RMDLTexture), dataSize) ||
+        !IsCountValidRMDL(info->boneCount, sizeof(rlBoneInfo), dataSize)))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file data is corrupted", fileName);
+        info = NULL;
+    }
+
+    if (info != NULL)
+    {
+        model.transform = info->transform;
+        model.meshCount = info->meshCount;
+        model.materialCount = info->materialCount;
+        model.boneCount = info->boneCount;
+
+        model.meshes = (rlMesh *)RL_CALLOC(model.meshCount, sizeof(rlMesh));
+        model.meshMaterial = (int *)LoadSectionRMDL(fileData, RMDL_SECTION_MESH_MATERIAL, 0, model.meshCount*sizeof(int));
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            rlMesh *mesh = &model.meshes[i];
+            const RMDLMesh *meshInfo = (const RMDLMesh *)GetSectionRMDL(fileData, RMDL_SECTION_MESH, i, sizeof(RMDLMesh));
+
+            // NOTE: Vertex count is checked against positions data size (required), indices and bones against smaller arrays
+            if ((meshInfo == NULL) || !IsCountValidRMDL(meshInfo->vertexCount, 3*sizeof(float), dataSize) ||
+                !IsCountValidRMDL(meshInfo->triangleCount, 3*sizeof(unsigned short), dataSize) ||
+                !IsCountValidRMDL(meshInfo->boneCount, sizeof(rlMatrix), dataSize))
+            {
+                TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load RMDL mesh %i data", fileName, i);
+                continue;
+            }
+
+            mesh->vertexCount = meshInfo->vertexCount;
+            mesh->triangleCount = meshInfo->triangleCount;
+
+            for (unsigned int type = RMDL_SECTION_MESH_VERTICES; type <= RMDL_SECTION_MESH_BONE_WEIGHTS; type++)
+            {
+                unsigned int size = 0;
+                void **array = GetMeshArrayRMDL(mesh, type, &size);
+                *array = LoadSectionRMDL(fileData, type, i, size);
+            }
+
+            // Animated vertex data and bones matrices, skinned meshes only
+            if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (mesh->vertices != NULL))
+            {
+                mesh->animVertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+                memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+                mesh->animNormals = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+                if (mesh->normals != NULL) memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+
+                mesh->boneCount = meshInfo->boneCount;
+                mesh->boneMatrices = (rlMatrix *)RL_MALLOC(mesh->boneCount*sizeof(rlMatrix));
+                for (int j = 0; j < mesh->boneCount; j++) mesh->boneMatrices[j] = MatrixIdentity();
+            }
+        }
+
+        // Load textures shared by materials maps
+        Texture2D *textures = (Texture2D *)RL_CALLOC(info->textureCount, sizeof(Texture2D));
+
+        for (int i = 0; i < info->textureCount; i++)
+        {
+            const RMDLTexture *texture = (const RMDLTexture *)GetSectionRMDL(fileData, RMDL_SECTION_TEXTURE, i, sizeof(RMDLTexture));
+
+            if ((texture != NULL) && (texture->width > 0) && (texture->height > 0) && (texture->mipmaps > 0) &&
+                (GetPixelDataSize(texture->width, texture->height, texture->format) > 0))
+            {
+                rlImage image = { NULL, texture->width, texture->height, texture->mipmaps, texture->format };
+                image.data = (void *)GetSectionRMDL(fileData, RMDL_SECTION_TEXTURE_DATA, i, GetPixelDataSize(image.width, image.height, image.format));
+
+                if (image.data != NULL) textures[i] = LoadModelTexture(image);
+            }
+        }
+
+        model.materials = (rlMaterial *)RL_CALLOC(model.materialCount, sizeof(rlMaterial));
+
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            const RMDLMaterial *material = (const RMDLMaterial *)GetSectionRMDL(fileData, RMDL_SECTION_MATERIAL, i, sizeof(RMDLMaterial));
+
+            if (material == NULL)
+            {
+                model.materials[i] = rlLoadMaterialDefault();
+                continue;
+            }
+
+            model.materials[i].shader.id = rlGetShaderIdDefault();
+            model.materials[i].shader.locs = rlGetShaderLocsDefault();
+            model.materials[i].maps = (rlMaterialMap *)RL_CALLOC(MAX_MATERIAL_MAPS, sizeof(rlMaterialMap));
+            for (int m = 0; m < 4; m++) model.materials[i].params[m] = material->params[m];
+
+            for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+            {
+                RMDLMaterialMap map = material->maps[m];
+
+                model.materials[i].maps[m].color = map.color;
+                model.materials[i].maps[m].value = map.value;
+
+                if (map.texture == RMDL_TEXTURE_DEFAULT) model.materials[i].maps[m].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                else if ((map.texture >= 0) && (map.texture < info->textureCount)) model.materials[i].maps[m].texture = textures[map.texture];
+            }
+        }
+
+        RL_FREE(textures);
+
+        model.bones = (rlBoneInfo *)LoadSectionRMDL(fileData, RMDL_SECTION_BONES, 0, model.boneCount*sizeof(rlBoneInfo));
+        model.bindPose = (rlTransform *)LoadSectionRMDL(fileData, RMDL_SECTION_BIND_POSE, 0, model.boneCount*sizeof(rlTransform));
+        if ((model.bones == NULL) || (model.bindPose == NULL)) model.boneCount = 0;
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load RMDL model data", fileName);
+
+    UnloadFileMapped(fileData, dataSize, mapped);
+
+    return model;
+}
+
+// Load RMDL animation data
+static rlModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount)
+{
+    rlModelAnimation *animations = NULL;
+    *animCount = 0;
+
+    int dataSize = 0;
+    bool mapped = false;
+    unsigned char *fileData = LoadFileMapped(fileName, &dataSize, &mapped);
+
+    if (fileData == NULL) return animations;
+
+    if (IsDataValidRMDL(fileData, dataSize, fileName))
+    {
+        while (GetSectionRMDL(fileData, RMDL_SECTION_ANIMATION, *animCount, sizeof(RMDLAnimation)) != NULL) (*animCount)++;
+
+        animations = (rlModelAnimation *)RL_CALLOC(*animCount, sizeof(rlModelAnimation));
+
+        for (int i = 0; i < *animCount; i++)
+        {
+            const RMDLAnimation *info = (const RMDLAnimation *)GetSectionRMDL(fileData, RMDL_SECTION_ANIMATION, i, sizeof(RMDLAnimation));
+
+            // Frame poses (frameCount*boneCount transforms) must fit in file data
+            if (!IsCountValidRMDL(info->boneCount, sizeof(rlTransform), dataSize) ||
+                !IsCountValidRMDL(info->frameCount, ((info->boneCount > 0)? info->boneCount : 1)*sizeof(rlTransform), dataSize))
+            {
+                TRACELOG(LOG_WARNING, "ANIMATION: [%s] Failed to load animation %i data", fileName, i);
+                continue;
+            }
+
+            const rlTransform *poses = (const rlTransform *)GetSectionRMDL(fileData, RMDL_SECTION_ANIMATION_POSES, i, info->frameCount*info->boneCount*sizeof(rlTransform));
+
+            animations[i].bones = (rlBoneInfo *)LoadSectionRMDL(fileData, RMDL_SECTION_ANIMATION_BONES, i, info->boneCount*sizeof(rlBoneInfo));
+            memcpy(animations[i].name, info->name, sizeof(animations[i].name));
+            animations[i].name[sizeof(animations[i].name) - 1] = '\0';
+
+            if ((animations[i].bones == NULL) || (poses == NULL))
+            {
+                TRACELOG(LOG_WARNING, "ANIMATION: [%s] Failed to load animation %i data", fileName, i);
+                continue;
+            }
+
+            animations[i].boneCount = info->boneCount;
+            animations[i].frameCount = info->frameCount;
+            animations[i].framePoses = (rlTransform **)RL_MALLOC(info->frameCount*sizeof(rlTransform *));
+
+            for (int frame = 0; frame < info->frameCount; frame++)
+            {
+                animations[i].framePoses[frame] = (rlTransform *)RL_MALLOC(info->boneCount*sizeof(rlTransform));
+                memcpy(animations[i].framePoses[frame], poses + frame*info->boneCount, info->boneCount*sizeof(rlTransform));
+            }
+        }
+    }
+
+    UnloadFileMapped(fileData, dataSize, mapped);
+
+    return animations;
+}
+
+// Check RMDL file data header and sections table
+static bool IsDataValidRMDL(const unsigned char *fileData, int dataSize, const char *fileName)
+{
+    const RMDLHeader *header = (const RMDLHeader *)fileData;
+
+    if ((dataSize < (int)sizeof(RMDLHeader)) || (strncmp(header->id, "rMDL", 4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file not valid", fileName);
+        return false;
+    }
+
+    if (header->version != RMDL_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file version not supported (%i), re-export model", fileName, header->version);
+        return false;
+    }
+
+    bool valid = (header->fileSize == (unsigned int)dataSize) &&
+                 (header->sectionCount <= (dataSize - sizeof(RMDLHeader))/sizeof(RMDLSection));
+
+    const RMDLSection *sections = (const RMDLSection *)(fileData + sizeof(RMDLHeader));
+
+    for (unsigned int i = 0; valid && (i < header->sectionCount); i++)
+    {
+        valid = ((sections[i].offset%RMDL_SECTION_ALIGNMENT) == 0) &&
+                (sections[i].offset <= header->fileSize) && (sections[i].size <= (header->fileSize - sections[i].offset));
+    }
+
+    if (!valid) TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file data is corrupted", fileName);
+
+    return valid;
+}
+
+// Check RMDL elements count fits in file data size, elements size products can not overflow
+static bool IsCountValidRMDL(int count, unsigned int elementSize, int dataSize)
+{
+    return (count >= 0) && ((unsigned int)count <= ((unsigned int)dataSize/elementSize));
+}
+
+// Get RMDL section data (NULL if not found or size is not matching)
+// NOTE: Data points into file data, it is aligned to RMDL_SECTION_ALIGNMENT
+static const void *GetSectionRMDL(const unsigned char *fileData, unsigned int type, unsigned int index, unsigned int size)
+{
+    const RMDLHeader *header = (const RMDLHeader *)fileData;
+    const RMDLSection *sections = (const RMDLSection *)(fileData + sizeof(RMDLHeader));
+
+    for (unsigned int i = 0; i < header->sectionCount; i++)
+    {
+        if ((sections[i].type == type) && (sections[i].index == index))
+        {
+            if ((sections[i].size == size) && (size > 0)) return fileData + sections[i].offset;
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+// Load RMDL section data copy (NULL if not found or size is not matching)
+static void *LoadSectionRMDL(const unsigned char *fileData, unsigned int type, unsigned int index, unsigned int size)
+{
+    void *data = NULL;
+    const void *section = GetSectionRMDL(fileData, type, index, size);
+
+    if (section != NULL)
+    {
+        data = RL_MALLOC(size);
+        memcpy(data, section, size);
+    }
+
+    return data;
+}
+
+// Get mesh vertex array pointer and data size for RMDL section type
+static void **GetMeshArrayRMDL(rlMesh *mesh, unsigned int type, unsigned int *size)
+{
+    void **array = NULL;
+
+    switch (type)
+    {
+        case RMDL_SECTION_MESH_VERTICES: array = (void **)&mesh->vertices; *size = mesh->vertexCount*3*sizeof(float); break;
+        case RMDL_SECTION_MESH_TEXCOORDS: array = (void **)&mesh->texcoords; *size = mesh->vertexCount*2*sizeof(float); break;
+        case RMDL_SECTION_MESH_TEXCOORDS2: array = (void **)&mesh->texcoords2; *size = mesh->vertexCount*2*sizeof(float); break;
+        case RMDL_SECTION_MESH_NORMALS: array = (void **)&mesh->normals; *size = mesh->vertexCount*3*sizeof(float); break;
+        case RMDL_SECTION_MESH_TANGENTS: array = (void **)&mesh->tangents; *size = mesh->vertexCount*4*sizeof(float); break;
+        case RMDL_SECTION_MESH_COLORS: array = (void **)&mesh->colors; *size = mesh->vertexCount*4*sizeof(unsigned char); break;
+        case RMDL_SECTION_MESH_INDICES: array = (void **)&mesh->indices; *size = mesh->triangleCount*3*sizeof(unsigned short); break;
+        case RMDL_SECTION_MESH_BONE_IDS: array = (void **)&mesh->boneIds; *size = mesh->vertexCount*4*sizeof(unsigned char); break;
+        case RMDL_SECTION_MESH_BONE_WEIGHTS: array = (void **)&mesh->boneWeights; *size = mesh->vertexCount*4*sizeof(float); break;
+        default: break;
+    }
+
+    return array;
+}
+
+// Add section to RMDL writer (data is not copied), empty sections are skipped
+static void AddSectionRMDL(RMDLWriter *writer, unsigned int type, unsigned int index, const void *data, unsigned int size)
+{
+    if ((data == NULL) || (size == 0)) return;
+
+    if (writer->sectionCount == writer->sectionCapacity)
+    {
+        writer->sectionCapacity = (writer->sectionCapacity > 0)? writer->sectionCapacity*2 : 64;
+        writer->sections = (RMDLSection *)RL_REALLOC(writer->sections, writer->sectionCapacity*sizeof(RMDLSection));
+        writer->sectionsData = (const void **)RL_REALLOC(writer->sectionsData, writer->sectionCapacity*sizeof(const void *));
+    }
+
+    writer->sections[writer->sectionCount] = (RMDLSection){ type, index, 0, size };
+    writer->sectionsData[writer->sectionCount] = data;
+    writer->sectionCount++;
+}
+
+// Save RMDL writer sections to file, writer is reset
+static bool SaveRMDL(RMDLWriter *writer, const char *fileName)
+{
+    #define RMDL_ALIGN(size) (((size) + RMDL_SECTION_ALIGNMENT - 1)/RMDL_SECTION_ALIGNMENT*RMDL_SECTION_ALIGNMENT)
+
+    // Sections data is placed after header and sections table, every section aligned
+    unsigned int fileSize = RMDL_ALIGN(sizeof(RMDLHeader) + writer->sectionCount*sizeof(RMDLSection));
+
+    for (int i = 0; i < writer->sectionCount; i++)
+    {
+        writer->sections[i].offset = fileSize;
+        fileSize += RMDL_ALIGN(writer->sections[i].size);
+    }
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(fileSize, 1);
+
+    RMDLHeader header = { { 'r', 'M', 'D', 'L' }, RMDL_VERSION, (unsigned int)writer->sectionCount, fileSize };
+    memcpy(fileData, &header, sizeof(RMDLHeader));
+    if (writer->sectionCount > 0) memcpy(fileData + sizeof(RMDLHeader), writer->sections, writer->sectionCount*sizeof(RMDLSection));
+
+    for (int i = 0; i < writer->sectionCount; i++) memcpy(fileData + writer->sections[i].offset, writer->sectionsData[i], writer->sections[i].size);
+
+    bool success = rlSaveFileData(fileName, fileData, fileSize);
+
+    RL_FREE(fileData);
+    RL_FREE(writer->sections);
+    RL_FREE(writer->sectionsData);
+    *writer = (RMDLWriter){ 0 };
+
+    return success;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
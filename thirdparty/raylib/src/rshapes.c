@@ -22,6 +22,9 @@
 *       #define SUPPORT_QUADS_DRAW_MODE
 *           Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*       Collision broadphase (rlSpatialHash) hashes shapes into uniform grid cells, grid is rebuilt
+*       on first query after any change, so moving all shapes every frame has the cost of one rebuild
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -58,6 +61,7 @@
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
+#include <string.h>     // Required for: memset()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -71,10 +75,51 @@
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
 
+#define SPATIAL_HASH_PROXY_REMOVED         0      // Spatial hash proxy shape: removed (free slot)
+#define SPATIAL_HASH_PROXY_REC             1      // Spatial hash proxy shape: rectangle
+#define SPATIAL_HASH_PROXY_CIRCLE          2      // Spatial hash proxy shape: circle
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Spatial hash shape, tested with shapes collision functions
+typedef struct SpatialHashShape {
+    int type;                   // Shape type (SPATIAL_HASH_PROXY_*)
+    rlRectangle rec;              // Rectangle (circle: bounds)
+    rlVector2 center;             // Circle center
+    float radius;               // Circle radius
+} SpatialHashShape;
+
+// Spatial hash proxy, shape inserted in broadphase
+typedef struct SpatialHashProxy {
+    SpatialHashShape shape;     // Proxy shape
+    int cellMin[2];             // Grid cells range minimum (inclusive)
+    int cellMax[2];             // Grid cells range maximum (inclusive)
+    int nextFree;               // Next removed proxy slot (only for removed proxies)
+} SpatialHashProxy;
+
+// Spatial hash entry, proxy overlapping one grid cell
+typedef struct SpatialHashEntry {
+    int proxy;                  // Proxy id
+    int cell[2];                // Grid cell coordinates (filter cells sharing hash bucket)
+    int cellMin[2];             // Proxy grid cells range minimum (filter duplicated pairs)
+    SpatialHashShape shape;     // Proxy shape copy, entries in same cell are contiguous in memory
+} SpatialHashEntry;
+
+// Spatial hash, grid cells entries sorted by hash bucket
+struct rlSpatialHash {
+    float cellSize;             // Grid cell size
+    SpatialHashProxy *proxies;  // Proxies (removed slots are linked by nextFree)
+    int proxyCount;             // Proxies count (including removed slots)
+    int proxyCapacity;          // Proxies allocated
+    int freeProxy;              // First removed proxy slot, -1 if none
+    SpatialHashEntry *entries;  // Cells entries, sorted by bucket
+    int entryCount;             // Cells entries count
+    int entryCapacity;          // Cells entries allocated
+    int *buckets;               // First entry per bucket (bucketCount + 1)
+    int bucketCount;            // Hash buckets count (power of two)
+    bool dirty;                 // Proxies changed, grid requires rebuild
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -86,6 +131,13 @@ static rlRectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // rlTexture so
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static int AddSpatialHashProxy(rlSpatialHash *hash, int type);        // Get free proxy slot for shape type (grows proxies array)
+static void SetSpatialHashProxyCells(rlSpatialHash *hash, SpatialHashProxy *proxy); // Set proxy grid cells range from bounds (grid requires rebuild)
+static void GetSpatialHashCells(const rlSpatialHash *hash, rlRectangle rec, int *cellMin, int *cellMax); // Get grid cells range touched by bounds
+static void UpdateSpatialHashGrid(rlSpatialHash *hash);               // Rebuild grid entries if proxies changed
+static int GetSpatialHashCollisions(rlSpatialHash *hash, SpatialHashProxy *query, int *ids, int maxIds); // Get proxies colliding with query shape
+static unsigned int GetSpatialHashBucket(const rlSpatialHash *hash, int x, int y); // Get grid cell hash bucket
+static bool CheckCollisionSpatialHashShapes(const SpatialHashShape *shape1, const SpatialHashShape *shape2); // Check collision between proxies shapes
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -2365,10 +2417,343 @@ rlRectangle rlGetCollisionRec(rlRectangle rec1, rlRectangle rec2)
     return overlap;
 }
 
+// Load spatial hash broadphase
+// NOTE: Shapes larger than cell size span several cells, so cell size should be close to common shapes size
+rlSpatialHash *rlLoadSpatialHash(float cellSize, int capacity)
+{
+    rlSpatialHash *hash = (rlSpatialHash *)RL_CALLOC(1, sizeof(rlSpatialHash));
+
+    if (capacity < 16) capacity = 16;
+
+    hash->cellSize = (cellSize > 0.0f)? cellSize : 64.0f;
+    hash->proxies = (SpatialHashProxy *)RL_MALLOC(capacity*sizeof(SpatialHashProxy));
+    hash->proxyCapacity = capacity;
+    hash->freeProxy = -1;
+
+    return hash;
+}
+
+// Unload spatial hash broadphase
+void rlUnloadSpatialHash(rlSpatialHash *hash)
+{
+    if (hash == NULL) return;
+
+    RL_FREE(hash->proxies);
+    RL_FREE(hash->entries);
+    RL_FREE(hash->buckets);
+    RL_FREE(hash);
+}
+
+// Add rectangle to spatial hash, returns proxy id
+int rlAddSpatialHashRec(rlSpatialHash *hash, rlRectangle rec)
+{
+    int id = AddSpatialHashProxy(hash, SPATIAL_HASH_PROXY_REC);
+    rlUpdateSpatialHashRec(hash, id, rec);
+
+    return id;
+}
+
+// Add circle to spatial hash, returns proxy id
+int rlAddSpatialHashCircle(rlSpatialHash *hash, rlVector2 center, float radius)
+{
+    int id = AddSpatialHashProxy(hash, SPATIAL_HASH_PROXY_CIRCLE);
+    rlUpdateSpatialHashCircle(hash, id, center, radius);
+
+    return id;
+}
+
+// Update spatial hash proxy as rectangle
+// NOTE: Removed proxies are not updated, their slot could be reused by a new proxy
+void rlUpdateSpatialHashRec(rlSpatialHash *hash, int id, rlRectangle rec)
+{
+    if ((id < 0) || (id >= hash->proxyCount) || (hash->proxies[id].shape.type == SPATIAL_HASH_PROXY_REMOVED)) return;
+
+    SpatialHashProxy *proxy = &hash->proxies[id];
+    proxy->shape.type = SPATIAL_HASH_PROXY_REC;
+    proxy->shape.rec = rec;
+    proxy->shape.center = (rlVector2){ rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+    proxy->shape.radius = 0.0f;
+
+    SetSpatialHashProxyCells(hash, proxy);
+}
+
+// Update spatial hash proxy as circle
+// NOTE: Removed proxies are not updated, their slot could be reused by a new proxy
+void rlUpdateSpatialHashCircle(rlSpatialHash *hash, int id, rlVector2 center, float radius)
+{
+    if ((id < 0) || (id >= hash->proxyCount) || (hash->proxies[id].shape.type == SPATIAL_HASH_PROXY_REMOVED)) return;
+
+    SpatialHashProxy *proxy = &hash->proxies[id];
+    proxy->shape.type = SPATIAL_HASH_PROXY_CIRCLE;
+    proxy->shape.rec = (rlRectangle){ center.x - radius, center.y - radius, 2.0f*radius, 2.0f*radius };
+    proxy->shape.center = center;
+    proxy->shape.radius = radius;
+
+    SetSpatialHashProxyCells(hash, proxy);
+}
+
+// Remove proxy from spatial hash
+// NOTE: Proxy slot is reused by next added proxy
+void rlRemoveSpatialHashProxy(rlSpatialHash *hash, int id)
+{
+    if ((id < 0) || (id >= hash->proxyCount) || (hash->proxies[id].shape.type == SPATIAL_HASH_PROXY_REMOVED)) return;
+
+    hash->proxies[id].shape.type = SPATIAL_HASH_PROXY_REMOVED;
+    hash->proxies[id].nextFree = hash->freeProxy;
+    hash->freeProxy = id;
+    hash->dirty = true;
+}
+
+// Get colliding proxies pairs, pairs ids written as [id1, id2] with id1 < id2
+// NOTE: Candidates sharing a grid cell are tested with shapes collision functions,
+// pairs sharing several cells are only reported on the first shared cell
+int rlGetSpatialHashPairs(rlSpatialHash *hash, int *pairs, int maxPairs)
+{
+    int pairCount = 0;
+
+    UpdateSpatialHashGrid(hash);
+
+    for (int b = 0; b < hash->bucketCount; b++)
+    {
+        for (int i = hash->buckets[b]; i < hash->buckets[b + 1]; i++)
+        {
+            const SpatialHashEntry *entry1 = &hash->entries[i];
+
+            for (int j = i + 1; j < hash->buckets[b + 1]; j++)
+            {
+                const SpatialHashEntry *entry2 = &hash->entries[j];
+                if ((entry1->cell[0] != entry2->cell[0]) || (entry1->cell[1] != entry2->cell[1])) continue;
+
+                // Shared cells range first cell is the one reporting the pair
+                int firstX = (entry1->cellMin[0] > entry2->cellMin[0])? entry1->cellMin[0] : entry2->cellMin[0];
+                int firstY = (entry1->cellMin[1] > entry2->cellMin[1])? entry1->cellMin[1] : entry2->cellMin[1];
+                if ((entry1->cell[0] != firstX) || (entry1->cell[1] != firstY)) continue;
+
+                if (!CheckCollisionSpatialHashShapes(&entry1->shape, &entry2->shape)) continue;
+
+                if (pairCount < maxPairs)
+                {
+                    pairs[pairCount*2] = (entry1->proxy < entry2->proxy)? entry1->proxy : entry2->proxy;
+                    pairs[pairCount*2 + 1] = (entry1->proxy < entry2->proxy)? entry2->proxy : entry1->proxy;
+                }
+
+                pairCount++;
+            }
+        }
+    }
+
+    return pairCount;
+}
+
+// Get proxies colliding with rectangle
+int rlGetSpatialHashCollisionsRec(rlSpatialHash *hash, rlRectangle rec, int *ids, int maxIds)
+{
+    SpatialHashProxy query = { 0 };
+    query.shape.type = SPATIAL_HASH_PROXY_REC;
+    query.shape.rec = rec;
+    query.shape.center = (rlVector2){ rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+
+    return GetSpatialHashCollisions(hash, &query, ids, maxIds);
+}
+
+// Get proxies colliding with circle
+int rlGetSpatialHashCollisionsCircle(rlSpatialHash *hash, rlVector2 center, float radius, int *ids, int maxIds)
+{
+    SpatialHashProxy query = { 0 };
+    query.shape.type = SPATIAL_HASH_PROXY_CIRCLE;
+    query.shape.rec = (rlRectangle){ center.x - radius, center.y - radius, 2.0f*radius, 2.0f*radius };
+    query.shape.center = center;
+    query.shape.radius = radius;
+
+    return GetSpatialHashCollisions(hash, &query, ids, maxIds);
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Get free proxy slot for shape type, removed slots are reused first
+static int AddSpatialHashProxy(rlSpatialHash *hash, int type)
+{
+    int id = hash->freeProxy;
+
+    if (id >= 0) hash->freeProxy = hash->proxies[id].nextFree;
+    else
+    {
+        if (hash->proxyCount == hash->proxyCapacity)
+        {
+            hash->proxyCapacity *= 2;
+            hash->proxies = (SpatialHashProxy *)RL_REALLOC(hash->proxies, hash->proxyCapacity*sizeof(SpatialHashProxy));
+        }
+
+        id = hash->proxyCount;
+        hash->proxyCount++;
+    }
+
+    memset(&hash->proxies[id], 0, sizeof(SpatialHashProxy));
+    hash->proxies[id].shape.type = type;    // Proxy is live, shape set on update
+
+    return id;
+}
+
+// Set proxy grid cells range from bounds, grid is marked for rebuild
+static void SetSpatialHashProxyCells(rlSpatialHash *hash, SpatialHashProxy *proxy)
+{
+    GetSpatialHashCells(hash, proxy->shape.rec, proxy->cellMin, proxy->cellMax);
+
+    hash->dirty = true;
+}
+
+// Get grid cells range touched by bounds
+// NOTE: Range includes cells touched by bounds edges, shapes collision functions accept touching circles
+static void GetSpatialHashCells(const rlSpatialHash *hash, rlRectangle rec, int *cellMin, int *cellMax)
+{
+    cellMin[0] = (int)floorf(rec.x/hash->cellSize);
+    cellMin[1] = (int)floorf(rec.y/hash->cellSize);
+    cellMax[0] = (int)floorf((rec.x + rec.width)/hash->cellSize);
+    cellMax[1] = (int)floorf((rec.y + rec.height)/hash->cellSize);
+}
+
+// Rebuild grid entries if proxies changed
+// NOTE: Entries are counting-sorted by hash bucket, so the full rebuild is linear in cells entries
+static void UpdateSpatialHashGrid(rlSpatialHash *hash)
+{
+    if (!hash->dirty && (hash->buckets != NULL)) return;
+
+    // Count cells entries
+    int entryCount = 0;
+    for (int i = 0; i < hash->proxyCount; i++)
+    {
+        const SpatialHashProxy *proxy = &hash->proxies[i];
+        if (proxy->shape.type == SPATIAL_HASH_PROXY_REMOVED) continue;
+
+        entryCount += (proxy->cellMax[0] - proxy->cellMin[0] + 1)*(proxy->cellMax[1] - proxy->cellMin[1] + 1);
+    }
+
+    if (entryCount > hash->entryCapacity)
+    {
+        hash->entryCapacity = entryCount + entryCount/2;
+        hash->entries = (SpatialHashEntry *)RL_REALLOC(hash->entries, hash->entryCapacity*sizeof(SpatialHashEntry));
+    }
+
+    // Buckets count: power of two greater than entries count
+    int bucketCount = 64;
+    while (bucketCount < entryCount) bucketCount *= 2;
+
+    if (bucketCount > hash->bucketCount)
+    {
+        hash->bucketCount = bucketCount;
+        hash->buckets = (int *)RL_REALLOC(hash->buckets, (hash->bucketCount + 1)*sizeof(int));
+    }
+
+    memset(hash->buckets, 0, (hash->bucketCount + 1)*sizeof(int));
+
+    // Bucket sizes, converted to first entry per bucket
+    for (int i = 0; i < hash->proxyCount; i++)
+    {
+        const SpatialHashProxy *proxy = &hash->proxies[i];
+        if (proxy->shape.type == SPATIAL_HASH_PROXY_REMOVED) continue;
+
+        for (int y = proxy->cellMin[1]; y <= proxy->cellMax[1]; y++)
+        {
+            for (int x = proxy->cellMin[0]; x <= proxy->cellMax[0]; x++) hash->buckets[GetSpatialHashBucket(hash, x, y)]++;
+        }
+    }
+
+    int first = 0;
+    for (int b = 0; b < hash->bucketCount; b++)
+    {
+        int size = hash->buckets[b];
+        hash->buckets[b] = first;
+        first += size;
+    }
+    hash->buckets[hash->bucketCount] = first;
+
+    // Place entries, every bucket first entry is moved to next bucket first entry
+    for (int i = 0; i < hash->proxyCount; i++)
+    {
+        const SpatialHashProxy *proxy = &hash->proxies[i];
+        if (proxy->shape.type == SPATIAL_HASH_PROXY_REMOVED) continue;
+
+        for (int y = proxy->cellMin[1]; y <= proxy->cellMax[1]; y++)
+        {
+            for (int x = proxy->cellMin[0]; x <= proxy->cellMax[0]; x++)
+            {
+                unsigned int b = GetSpatialHashBucket(hash, x, y);
+                SpatialHashEntry *entry = &hash->entries[hash->buckets[b]];
+
+                entry->proxy = i;
+                entry->cell[0] = x;
+                entry->cell[1] = y;
+                entry->cellMin[0] = proxy->cellMin[0];
+                entry->cellMin[1] = proxy->cellMin[1];
+                entry->shape = proxy->shape;
+                hash->buckets[b]++;
+            }
+        }
+    }
+
+    for (int b = hash->bucketCount; b > 0; b--) hash->buckets[b] = hash->buckets[b - 1];
+    hash->buckets[0] = 0;
+
+    hash->entryCount = entryCount;
+    hash->dirty = false;
+}
+
+// Get proxies colliding with query shape
+// NOTE: Proxy is only reported on first cell shared with query cells range,
+// query is not a proxy, so grid is only rebuilt if proxies changed
+static int GetSpatialHashCollisions(rlSpatialHash *hash, SpatialHashProxy *query, int *ids, int maxIds)
+{
+    int count = 0;
+
+    GetSpatialHashCells(hash, query->shape.rec, query->cellMin, query->cellMax);
+    UpdateSpatialHashGrid(hash);
+
+    for (int y = query->cellMin[1]; y <= query->cellMax[1]; y++)
+    {
+        for (int x = query->cellMin[0]; x <= query->cellMax[0]; x++)
+        {
+            unsigned int b = GetSpatialHashBucket(hash, x, y);
+
+            for (int i = hash->buckets[b]; i < hash->buckets[b + 1]; i++)
+            {
+                const SpatialHashEntry *entry = &hash->entries[i];
+                if ((entry->cell[0] != x) || (entry->cell[1] != y)) continue;
+
+                if ((x != ((entry->cellMin[0] > query->cellMin[0])? entry->cellMin[0] : query->cellMin[0])) ||
+                    (y != ((entry->cellMin[1] > query->cellMin[1])? entry->cellMin[1] : query->cellMin[1]))) continue;
+
+                if (!CheckCollisionSpatialHashShapes(&query->shape, &entry->shape)) continue;
+
+                if (count < maxIds) ids[count] = entry->proxy;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+// Get grid cell hash bucket
+static unsigned int GetSpatialHashBucket(const rlSpatialHash *hash, int x, int y)
+{
+    return (((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u)) & ((unsigned int)hash->bucketCount - 1);
+}
+
+// Check collision between proxies shapes
+static bool CheckCollisionSpatialHashShapes(const SpatialHashShape *shape1, const SpatialHashShape *shape2)
+{
+    bool collision = false;
+
+    if ((shape1->type == SPATIAL_HASH_PROXY_REC) && (shape2->type == SPATIAL_HASH_PROXY_REC)) collision = rlCheckCollisionRecs(shape1->rec, shape2->rec);
+    else if ((shape1->type == SPATIAL_HASH_PROXY_CIRCLE) && (shape2->type == SPATIAL_HASH_PROXY_CIRCLE)) collision = rlCheckCollisionCircles(shape1->center, shape1->radius, shape2->center, shape2->radius);
+    else if (shape1->type == SPATIAL_HASH_PROXY_CIRCLE) collision = rlCheckCollisionCircleRec(shape1->center, shape1->radius, shape2->rec);
+    else collision = rlCheckCollisionCircleRec(shape2->center, shape2->radius, shape1->rec);
+
+    return collision;
+}
+
 // Cubic easing in-out
 // NOTE: Used by rlDrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
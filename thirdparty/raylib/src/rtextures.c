@@ -236,10 +236,63 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_PARALLEL_MIN_PIXELS
+    #define IMAGE_PARALLEL_MIN_PIXELS  262144   // Minimum image pixels count to process image rows in parallel (512x512)
+#endif
+
+// rlImageDither() wavefront tiles size, tile width must be bigger than height + 1
+#define IMAGE_DITHER_TILE_WIDTH     64
+#define IMAGE_DITHER_TILE_HEIGHT    16
+
+// rlImageBlurGaussian() columns tile width (pixels), columns in a tile are blurred together
+#define IMAGE_BLUR_TILE_WIDTH       16
+
+#ifndef MIN
+    #define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// rlImage job data, image rows (or columns) are split across jobs
+typedef struct ImageJob {
+    rlImage image;                      // rlImage to process (or converted image on formatting)
+    rlImage target;                     // Converted image (direct format conversion)
+    rlColor *colors;                    // rlImage colors (input or in-place processing)
+    rlColor *output;                    // Output colors
+    rlVector4 *pixels;                  // Normalized pixels
+    const float *kernel;                // Convolution kernel
+    int size;                           // Kernel width or blur size
+    rlColor color;                      // Tint color
+    float contrast;                     // Contrast factor
+    int brightness;                     // Brightness offset
+    int bpp[4];                         // Dithering bits per channel (RGBA)
+    int step;                           // Dithering wavefront step
+    int offset;                         // Dithering first tiles row
+    STBIR_RESIZE *resize;               // Resize data (splits processed by jobs)
+    int *splitStarts;                   // Resize splits groups first split (groups count + 1 entries)
+} ImageJob;
+
+// rlImage direct pixel format converter
+typedef struct ImageFormatConverter {
+    int format;                         // Source pixel format
+    int newFormat;                      // Destination pixel format
+    ParallelJobCallback job;            // Converter job (rows range)
+} ImageFormatConverter;
+
+// rlImage draw job data, destination rows are split across jobs
+typedef struct ImageDrawJob {
+    rlImage dst;                        // Destination image
+    rlImage src;                        // Source image
+    int srcX, srcY;                     // Source rectangle position
+    int srcWidth, srcHeight;            // Source rectangle size
+    int dstX, dstY;                     // Destination rectangle position (could be out of bounds)
+    int dstWidth, dstHeight;            // Destination rectangle size (source scaled if different)
+    int startX, endX;                   // Destination visible columns range
+    int startY;                         // Destination first visible row
+    rlColor tint;                       // Source tint color
+    bool blend;                         // Source alpha blending required
+} ImageDrawJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -254,9 +307,41 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
-static float HalfToFloat(unsigned short x);
-static unsigned short FloatToHalf(float x);
 static rlVector4 *LoadImageDataNormalized(rlImage image);       // Load pixel data from image as rlVector4 array (float normalized)
+static int GetPixelComponents(int format);                       // Get pixel format components count (channels)
+
+static void RunImageJob(ParallelJobCallback job, void *data, int count, int pixelCount); // Run image job, in parallel for big images
+static void LoadImageNormalizedJob(void *data, int start, int end);     // Image job: load normalized pixels data
+static void LoadImageColorsJob(void *data, int start, int end);         // Image job: load colors data
+static void ImageFormatJob(void *data, int start, int end);             // Image job: format normalized pixels data
+static ParallelJobCallback GetImageFormatConverter(int format, int newFormat); // Get direct pixel format converter job
+static void ImageConvertRGBAToRGBJob(void *data, int start, int end);   // Image job: convert RGBA 8bit to RGB 8bit
+static void ImageConvertRGBToRGBAJob(void *data, int start, int end);   // Image job: convert RGB 8bit to RGBA 8bit
+static void ImageConvertRGBAToGrayJob(void *data, int start, int end);  // Image job: convert RGB/RGBA 8bit to grayscale/gray-alpha
+static void ImageConvertGrayToRGBAJob(void *data, int start, int end);  // Image job: convert grayscale/gray-alpha to RGBA 8bit
+static void ImageConvertRGBATo16bitJob(void *data, int start, int end); // Image job: convert RGBA 8bit to 16bit packed formats
+static void ImageConvert16bitToRGBAJob(void *data, int start, int end); // Image job: convert 16bit packed formats to RGBA 8bit
+static void ImageConvert8bitToFloatJob(void *data, int start, int end); // Image job: convert RGB/RGBA 8bit to 32bit/16bit float
+static void ImageConvertFloatTo8bitJob(void *data, int start, int end); // Image job: convert 32bit/16bit float to RGB/RGBA 8bit
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels); // Resize image data (8 bit per channel)
+static void ImageResizeJob(void *data, int start, int end);             // Image job: resize image splits groups
+static int GetResizeSplitStarts(STBIR_RESIZE *resize, int splits, int *splitStarts); // Get resize splits groups safe to run independently
+static void ImageDrawRowsJob(void *data, int start, int end);           // Image job: draw source image into destination rows
+static void GetImageDrawSample(int position, int dstSize, int srcSize, int *sample, int *weight); // Get scaled source sample position and weight
+static void LoadImageLineColors(rlImage image, int x, int y, int count, rlColor *colors); // Load colors line from image data
+static void SetImageLineColors(rlImage image, int x, int y, int count, const rlColor *colors); // Set colors line into image data
+static void BlendImageLine(rlColor *dst, const rlColor *src, int count, rlColor tint); // Alpha blend colors line with tint
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ImageBlurRowsJob(void *data, int start, int end);           // Image job: premultiply alpha and box blur rows
+static void ImageBlurColumnsJob(void *data, int start, int end);        // Image job: box blur columns tiles and reverse alpha premultiply
+static void BlurImageLine(const unsigned char *src, int srcStride, unsigned char *dst, int dstStride, int length, int lanes, int radius); // Box blur a line of elements
+static void ImageKernelConvolutionJob(void *data, int start, int end);  // Image job: kernel convolution
+static void ImageDitherJob(void *data, int start, int end);             // Image job: dither wavefront step tiles
+static void DitherImagePixel(ImageJob *job, int x, int y);              // Dither image pixel (Floyd-Steinberg)
+static void ImageColorTintJob(void *data, int start, int end);          // Image job: tint colors
+static void ImageColorContrastJob(void *data, int start, int end);      // Image job: adjust colors contrast
+static void ImageColorBrightnessJob(void *data, int start, int end);    // Image job: adjust colors brightness
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1254,190 +1339,44 @@ void rlImageFormat(rlImage *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            rlVector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            ParallelJobCallback converter = GetImageFormatConverter(image->format, newFormat);
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
-
-            switch (image->format)
+            if (converter != NULL)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: rlImage is converted to GRAYSCALE equivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                // Direct conversion between formats, no intermediate normalized pixels data required
+                ImageJob job = { 0 };
+                job.image = *image;
+                job.target = *image;
+                job.target.format = newFormat;
+                job.target.data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+
+                RunImageJob(converter, &job, image->height, image->width*image->height);
+
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = job.target.data;
+                image->format = newFormat;
+            }
+            else
+            {
+                rlVector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: rlImage is converted to GRAYSCALE equivalent 16bit
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                // Convert pixels data by rows, every row is converted independently
+                image->data = RL_MALLOC(GetPixelDataSize(image->width, image->height, image->format));
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                ImageJob job = { 0 };
+                job.image = *image;
+                job.pixels = pixels;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                RunImageJob(ImageFormatJob, &job, image->height, image->width*image->height);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+                RL_FREE(pixels);
+                pixels = NULL;
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
-
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
             if (image->mipmaps > 1)
@@ -1673,19 +1612,19 @@ rlImage rlImageFromChannel(rlImage image, int selectedChannel)
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16:
                 {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixelValue = rlHalfToFloat(((unsigned short *)image.data)[k]);
                     k += 1;
 
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                 {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k+selectedChannel]);
+                    pixelValue = rlHalfToFloat(((unsigned short *)image.data)[k+selectedChannel]);
                     k += 3;
 
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                 {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k + selectedChannel]);
+                    pixelValue = rlHalfToFloat(((unsigned short *)image.data)[k + selectedChannel]);
                     k += 4;
 
                 } break;
@@ -1759,14 +1698,7 @@ void rlImageResize(rlImage *image, int newWidth, int newHeight)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1780,7 +1712,7 @@ void rlImageResize(rlImage *image, int newWidth, int newHeight)
         rlColor *output = (rlColor *)RL_MALLOC(newWidth*newHeight*sizeof(rlColor));
 
         // NOTE: rlColor data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -1983,12 +1915,12 @@ void rlImageAlphaClear(rlImage *image, rlColor color, float threshold)
             {
                 for (int i = 3; i < image->width*image->height*4; i += 4)
                 {
-                    if (HalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
+                    if (rlHalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
                     {
-                        ((unsigned short *)image->data)[i - 3] = FloatToHalf((float)color.r/255.0f);
-                        ((unsigned short *)image->data)[i - 2] = FloatToHalf((float)color.g/255.0f);
-                        ((unsigned short *)image->data)[i - 1] = FloatToHalf((float)color.b/255.0f);
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)color.a/255.0f);
+                        ((unsigned short *)image->data)[i - 3] = rlFloatToHalf((float)color.r/255.0f);
+                        ((unsigned short *)image->data)[i - 2] = rlFloatToHalf((float)color.g/255.0f);
+                        ((unsigned short *)image->data)[i - 1] = rlFloatToHalf((float)color.b/255.0f);
+                        ((unsigned short *)image->data)[i] = rlFloatToHalf((float)color.a/255.0f);
                     }
                 }
             } break;
@@ -2087,139 +2019,22 @@ void rlImageAlphaPremultiply(rlImage *image)
 void rlImageBlurGaussian(rlImage *image, int blurSize)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    rlImageAlphaPremultiply(image);
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
 
+    // Blur is applied in-place on premultiplied alpha colors, rows first and then columns tiles
+    // NOTE: Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
     rlColor *pixels = rlLoadImageColors(*image);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    rlVector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(rlVector4));
-    rlVector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(rlVector4));
-
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
-
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
+    ImageJob job = { 0 };
+    job.image = *image;
+    job.colors = pixels;
+    job.size = blurSize;
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
+    RunImageJob(ImageBlurRowsJob, &job, image->height, image->width*image->height);
+    RunImageJob(ImageBlurColumnsJob, &job, (image->width + IMAGE_BLUR_TILE_WIDTH - 1)/IMAGE_BLUR_TILE_WIDTH, image->width*image->height);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2242,117 +2057,22 @@ void rlImageKernelConvolution(rlImage *image, const float *kernel, int kernelSiz
     }
 
     rlColor *pixels = rlLoadImageColors(*image);
+    rlColor *output = (rlColor *)RL_MALLOC(image->width*image->height*sizeof(rlColor));
 
-    rlVector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(rlVector4));
-    rlVector4 *temp = RL_MALLOC(kernelSize*sizeof(rlVector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
-
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
-
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+    ImageJob job = { 0 };
+    job.image = *image;
+    job.colors = pixels;
+    job.output = output;
+    job.kernel = kernel;
+    job.size = kernelWidth;
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
-
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
-
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
+    RunImageJob(ImageKernelConvolutionJob, &job, image->height, image->width*image->height);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    rlUnloadImageColors(pixels);
 
-    image->data = pixels;
+    image->data = output;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     rlImageFormat(image, format);
 }
@@ -2469,69 +2189,40 @@ void rlImageDither(rlImage *image, int rBpp, int gBpp, int bBpp, int aBpp)
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        rlColor oldPixel = WHITE;
-        rlColor newPixel = WHITE;
+        ImageJob job = { 0 };
+        job.image = *image;
+        job.colors = pixels;
+        job.bpp[0] = rBpp;
+        job.bpp[1] = gBpp;
+        job.bpp[2] = bBpp;
+        job.bpp[3] = aBpp;
 
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-
-        for (int y = 0; y < image->height; y++)
+        if ((image->width*image->height) >= IMAGE_PARALLEL_MIN_PIXELS)
         {
-            for (int x = 0; x < image->width; x++)
+            // Floyd-Steinberg error diffusion processed in tiles wavefront, every tile is a
+            // parallelogram skewed one pixel per row, so it only depends on tiles from previous steps:
+            // left tile (r, c - 1) and tiles above (r - 1, c) and (r - 1, c + 1), step = c + 2*r
+            // NOTE: Diffused errors are always positive and saturated, result matches sequential dithering
+            int rows = (image->height + IMAGE_DITHER_TILE_HEIGHT - 1)/IMAGE_DITHER_TILE_HEIGHT;
+            int cols = (image->width + IMAGE_DITHER_TILE_HEIGHT - 1 + IMAGE_DITHER_TILE_WIDTH - 1)/IMAGE_DITHER_TILE_WIDTH;
+
+            for (int step = 0; step < (cols + 2*(rows - 1)); step++)
             {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check rlImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
-
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
-
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
-
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
-
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
-
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
-
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+                int firstRow = (step - cols + 2)/2;
+                if (firstRow < 0) firstRow = 0;
+                int lastRow = step/2;
+                if (lastRow > (rows - 1)) lastRow = rows - 1;
+
+                job.step = step;
+                job.offset = firstRow;
+                RunParallelFor(ImageDitherJob, &job, lastRow - firstRow + 1);
+            }
+        }
+        else
+        {
+            for (int y = 0; y < image->height; y++)
+            {
+                for (int x = 0; x < image->width; x++) DitherImagePixel(&job, x, y);
             }
         }
 
@@ -2739,18 +2430,12 @@ void rlImageColorTint(rlImage *image, rlColor color)
 
     rlColor *pixels = rlLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+    ImageJob job = { 0 };
+    job.image = *image;
+    job.colors = pixels;
+    job.color = color;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
+    RunImageJob(ImageColorTintJob, &job, image->height, image->width*image->height);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2806,36 +2491,12 @@ void rlImageColorContrast(rlImage *image, float contrast)
 
     rlColor *pixels = rlLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
+    ImageJob job = { 0 };
+    job.image = *image;
+    job.colors = pixels;
+    job.contrast = contrast;
 
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
+    RunImageJob(ImageColorContrastJob, &job, image->height, image->width*image->height);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2858,25 +2519,12 @@ void rlImageColorBrightness(rlImage *image, int brightness)
 
     rlColor *pixels = rlLoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+    ImageJob job = { 0 };
+    job.image = *image;
+    job.colors = pixels;
+    job.brightness = brightness;
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
+    RunImageJob(ImageColorBrightnessJob, &job, image->height, image->width*image->height);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2938,132 +2586,11 @@ rlColor *rlLoadImageColors(rlImage image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+        ImageJob job = { 0 };
+        job.image = image;
+        job.colors = pixels;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
+        RunImageJob(LoadImageColorsJob, &job, image.height, image.width*image.height);
     }
 
     return pixels;
@@ -3275,7 +2802,7 @@ rlColor rlGetImageColor(rlImage image, int x, int y)
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
                 color.g = 0;
                 color.b = 0;
                 color.a = 255;
@@ -3283,18 +2810,18 @@ rlColor rlGetImageColor(rlImage image, int x, int y)
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
+                color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
+                color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
                 color.a = 255;
 
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.a = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
 
             } break;
             default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
@@ -3441,7 +2968,7 @@ void rlImageDrawPixel(rlImage *dst, int x, int y, rlColor color)
             // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
             rlVector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+            ((unsigned short*)dst->data)[y*dst->width + x] = rlFloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
@@ -3449,19 +2976,19 @@ void rlImageDrawPixel(rlImage *dst, int x, int y, rlColor color)
             // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
             rlVector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = rlFloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = rlFloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = rlFloatToHalf(coln.z);
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
         {
             // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
             rlVector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = rlFloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = rlFloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = rlFloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = rlFloatToHalf(coln.w);
 
         } break;
         default: break;
@@ -3915,107 +3442,55 @@ void rlImageDraw(rlImage *dst, rlImage src, rlRectangle srcRec, rlRectangle dstR
     if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rlImage drawing not supported for compressed formats");
     else
     {
-        rlImage srcMod = { 0 };       // Source copy (in case it was required)
-        rlImage *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
         // Source rectangle out-of-bounds security checks
         if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
         if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
         if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
-        {
-            srcMod = rlImageFromImage(src, srcRec);   // Create image from another image
-            rlImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (rlRectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
-
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
-
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
-
-        if (dstRec.y < 0)
-        {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
-
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+        ImageDrawJob job = { 0 };
+        job.dst = *dst;
+        job.src = src;
+        job.srcX = (int)srcRec.x;
+        job.srcY = (int)srcRec.y;
+        job.srcWidth = (int)srcRec.width;
+        job.srcHeight = (int)srcRec.height;
+        job.dstX = (int)dstRec.x;
+        job.dstY = (int)dstRec.y;
+        job.dstWidth = (int)dstRec.width;
+        job.dstHeight = (int)dstRec.height;
+        job.tint = tint;
+
+        if ((job.srcWidth <= 0) || (job.srcHeight <= 0) || (job.dstWidth <= 0) || (job.dstHeight <= 0)) return;
+
+        // Destination rectangle out-of-bounds security checks, only visible rows/columns are processed
+        job.startX = (job.dstX < 0)? 0 : job.dstX;
+        job.endX = ((job.dstX + job.dstWidth) > dst->width)? dst->width : job.dstX + job.dstWidth;
+        job.startY = (job.dstY < 0)? 0 : job.dstY;
+        int endY = ((job.dstY + job.dstHeight) > dst->height)? dst->height : job.dstY + job.dstHeight;
+
+        if ((job.endX <= job.startX) || (endY <= job.startY)) return;
 
         // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+        // for every row -> [get_src_line (scaled if required) / get_dst_line -> blend_line -> dst_line_format]
         // Some optimization ideas:
         //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize rlImageResize() for pixel format (alternative: rlImageResizeNN())
+        //    [x] Scale source inline while drawing (bilinear), no source copy and resize required
         //    [x] Optimize rlColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
         //    [x] Optimize rlColorAlphaBlend() for faster operations (maybe avoiding divs?)
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] rlGetPixelColor(): Get rlVector4 instead of rlColor, easier for rlColorAlphaBlend()
+        //    [x] Consider fast path: RGBA 8bit src/dst lines accessed directly, no pixel conversion
+        //    [x] Draw big images rows in parallel
         //    [ ] Support f32bit channels drawing
 
         // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
 
-        rlColor colSrc, colDst, blend;
-        bool blendRequired = true;
-
         // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
-
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
-
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
-
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
-
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
-
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = rlGetPixelColor(pSrc, srcPtr->format);
-                    colDst = rlGetPixelColor(pDst, dst->format);
+        job.blend = true;
+        if ((tint.a == 255) && ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) job.blend = false;
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = rlColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
-
-                    rlSetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
-
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
-        }
-
-        if (useSrcMod) rlUnloadImage(srcMod);     // Unload source modified image
+        RunImageJob(ImageDrawRowsJob, &job, endY - job.startY, (job.endX - job.startX)*(endY - job.startY));
     }
 }
 
@@ -4453,6 +3928,20 @@ void rlDrawTexturePro(Texture2D texture, rlRectangle source, rlRectangle dest, r
         if (dest.width < 0) dest.width *= -1;
         if (dest.height < 0) dest.height *= -1;
 
+#if defined(SUPPORT_SPRITE_INSTANCING)
+        // Instanced sprite, quad vertex generated on GPU from sprite parameters
+        // NOTE: Immediate mode drawing used if sprite batch not available (custom shader, rlPushMatrix()...)
+        rlSpriteInstance sprite = {
+            { dest.x, dest.y, dest.width, dest.height },
+            { (flipX? (source.x + source.width) : source.x)/width, source.y/height,
+              (flipX? source.x : (source.x + source.width))/width, (source.y + source.height)/height },
+            { origin.x, origin.y, rotation, 0.0f },
+            { tint.r, tint.g, tint.b, tint.a }
+        };
+
+        if (rlDrawSpriteInstance(texture.id, &sprite)) return;
+#endif
+
         rlVector2 topLeft = { 0 };
         rlVector2 topRight = { 0 };
         rlVector2 bottomLeft = { 0 };
@@ -5164,28 +4653,28 @@ rlColor rlGetPixelColor(void *srcPtr, int format)
         case PIXELFORMAT_UNCOMPRESSED_R16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
             color.a = 255;
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
             color.a = 255;
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
 
         } break;
         default: break;
@@ -5329,170 +4818,1371 @@ int GetPixelDataSize(int width, int height, int format)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 // Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
-{
-    float result = 0.0f;
-
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
-
-    result = *(float *)&r;
-
-    return result;
-}
-
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Get pixel data from image as rlVector4 array (float normalized)
+static rlVector4 *LoadImageDataNormalized(rlImage image)
 {
-    unsigned short result = 0;
+    rlVector4 *pixels = (rlVector4 *)RL_MALLOC(image.width*image.height*sizeof(rlVector4));
 
-    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        ImageJob job = { 0 };
+        job.image = image;
+        job.pixels = pixels;
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+        RunImageJob(LoadImageNormalizedJob, &job, image.height, image.width*image.height);
+    }
 
-    return result;
+    return pixels;
 }
 
-// Get pixel data from image as rlVector4 array (float normalized)
-static rlVector4 *LoadImageDataNormalized(rlImage image)
+// Image job: load normalized pixels data from image (rows range)
+static void LoadImageNormalizedJob(void *data, int start, int end)
 {
-    rlVector4 *pixels = (rlVector4 *)RL_MALLOC(image.width*image.height*sizeof(rlVector4));
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    rlVector4 *pixels = job->pixels;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    for (int i = start*image.width, k = i*GetPixelComponents(image.format); i < end*image.width; i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        switch (image.format)
         {
-            switch (image.format)
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].w = 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                pixels[i].w = 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+                pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                pixels[i].w = 1.0f;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = ((float *)image.data)[k + 1];
+                pixels[i].z = ((float *)image.data)[k + 2];
+                pixels[i].w = 1.0f;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = ((float *)image.data)[k + 1];
+                pixels[i].z = ((float *)image.data)[k + 2];
+                pixels[i].w = ((float *)image.data)[k + 3];
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = rlHalfToFloat(((unsigned short *)image.data)[k + 1]);
+                pixels[i].z = rlHalfToFloat(((unsigned short *)image.data)[k + 2]);
+                pixels[i].w = 1.0f;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = rlHalfToFloat(((unsigned short *)image.data)[k + 1]);
+                pixels[i].z = rlHalfToFloat(((unsigned short *)image.data)[k + 2]);
+                pixels[i].w = rlHalfToFloat(((unsigned short *)image.data)[k + 3]);
+
+                k += 4;
+            } break;
+            default: break;
         }
     }
+}
 
-    return pixels;
+// Image job: load colors data from image (rows range)
+static void LoadImageColorsJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    rlColor *pixels = job->colors;
+
+    for (int i = start*image.width, k = i*GetPixelComponents(image.format); i < end*image.width; i++)
+    {
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[i];
+                pixels[i].g = ((unsigned char *)image.data)[i];
+                pixels[i].b = ((unsigned char *)image.data)[i];
+                pixels[i].a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[k];
+                pixels[i].g = ((unsigned char *)image.data)[k];
+                pixels[i].b = ((unsigned char *)image.data)[k];
+                pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                pixels[i].a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[k];
+                pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                pixels[i].b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                pixels[i].b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                pixels[i].a = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Image job: format normalized pixels data into image format (rows range)
+static void ImageFormatJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    const rlVector4 *pixels = job->pixels;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                ((unsigned char *)image.data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int k = start*image.width, i = k*2; k < end*image.width; i += 2, k++)
+            {
+                ((unsigned char *)image.data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                ((unsigned char *)image.data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*63.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                ((unsigned short *)image.data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int k = start*image.width, i = k*3; k < end*image.width; i += 3, k++)
+            {
+                ((unsigned char *)image.data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                ((unsigned char *)image.data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                ((unsigned char *)image.data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*31.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+                a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                ((unsigned short *)image.data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*15.0f));
+                g = (unsigned char)(round(pixels[i].y*15.0f));
+                b = (unsigned char)(round(pixels[i].z*15.0f));
+                a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                ((unsigned short *)image.data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int k = start*image.width, i = k*4; k < end*image.width; i += 4, k++)
+            {
+                ((unsigned char *)image.data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                ((unsigned char *)image.data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                ((unsigned char *)image.data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                ((unsigned char *)image.data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // WARNING: rlImage is converted to GRAYSCALE equivalent 32bit
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                ((float *)image.data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int k = start*image.width, i = k*3; k < end*image.width; i += 3, k++)
+            {
+                ((float *)image.data)[i] = pixels[k].x;
+                ((float *)image.data)[i + 1] = pixels[k].y;
+                ((float *)image.data)[i + 2] = pixels[k].z;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int k = start*image.width, i = k*4; k < end*image.width; i += 4, k++)
+            {
+                ((float *)image.data)[i] = pixels[k].x;
+                ((float *)image.data)[i + 1] = pixels[k].y;
+                ((float *)image.data)[i + 2] = pixels[k].z;
+                ((float *)image.data)[i + 3] = pixels[k].w;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // WARNING: rlImage is converted to GRAYSCALE equivalent 16bit
+            for (int i = start*image.width; i < end*image.width; i++)
+            {
+                ((unsigned short *)image.data)[i] = rlFloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int k = start*image.width, i = k*3; k < end*image.width; i += 3, k++)
+            {
+                ((unsigned short *)image.data)[i] = rlFloatToHalf(pixels[k].x);
+                ((unsigned short *)image.data)[i + 1] = rlFloatToHalf(pixels[k].y);
+                ((unsigned short *)image.data)[i + 2] = rlFloatToHalf(pixels[k].z);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int k = start*image.width, i = k*4; k < end*image.width; i += 4, k++)
+            {
+                ((unsigned short *)image.data)[i] = rlFloatToHalf(pixels[k].x);
+                ((unsigned short *)image.data)[i + 1] = rlFloatToHalf(pixels[k].y);
+                ((unsigned short *)image.data)[i + 2] = rlFloatToHalf(pixels[k].z);
+                ((unsigned short *)image.data)[i + 3] = rlFloatToHalf(pixels[k].w);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Image job: convert RGBA 8bit to RGB 8bit (rows range)
+static void ImageConvertRGBAToRGBJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+
+    for (int i = start*job->image.width; i < end*job->image.width; i++)
+    {
+        dst[i*3] = src[i*4];
+        dst[i*3 + 1] = src[i*4 + 1];
+        dst[i*3 + 2] = src[i*4 + 2];
+    }
+}
+
+// Image job: convert RGB 8bit to RGBA 8bit (rows range)
+static void ImageConvertRGBToRGBAJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+
+    for (int i = start*job->image.width; i < end*job->image.width; i++)
+    {
+        dst[i*4] = src[i*3];
+        dst[i*4 + 1] = src[i*3 + 1];
+        dst[i*4 + 2] = src[i*3 + 2];
+        dst[i*4 + 3] = 255;
+    }
+}
+
+// Image job: convert RGB/RGBA 8bit to grayscale/gray-alpha 8bit (rows range)
+// NOTE: Gray value computed as normalized path does, results must match
+static void ImageConvertRGBAToGrayJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+    int srcComponents = GetPixelComponents(job->image.format);
+    int dstComponents = GetPixelComponents(job->target.format);
+
+    for (int i = start*job->image.width; i < end*job->image.width; i++)
+    {
+        const unsigned char *pixel = src + i*srcComponents;
+
+        dst[i*dstComponents] = (unsigned char)(((float)pixel[0]/255.0f*0.299f + (float)pixel[1]/255.0f*0.587f + (float)pixel[2]/255.0f*0.114f)*255.0f);
+        if (dstComponents == 2) dst[i*2 + 1] = (srcComponents == 4)? pixel[3] : 255;
+    }
+}
+
+// Image job: convert grayscale/gray-alpha 8bit to RGBA 8bit (rows range)
+static void ImageConvertGrayToRGBAJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+
+    if (job->image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        for (int i = start*job->image.width; i < end*job->image.width; i++)
+        {
+            dst[i*4] = src[i];
+            dst[i*4 + 1] = src[i];
+            dst[i*4 + 2] = src[i];
+            dst[i*4 + 3] = 255;
+        }
+    }
+    else
+    {
+        for (int i = start*job->image.width; i < end*job->image.width; i++)
+        {
+            dst[i*4] = src[i*2];
+            dst[i*4 + 1] = src[i*2];
+            dst[i*4 + 2] = src[i*2];
+            dst[i*4 + 3] = src[i*2 + 1];
+        }
+    }
+}
+
+// Image job: convert RGBA 8bit to 16bit packed formats (rows range)
+// NOTE: (c*max + 127)/255 matches round(c/255.0f*max) used by normalized path
+static void ImageConvertRGBATo16bitJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    unsigned short *dst = (unsigned short *)job->target.data;
+
+    switch (job->target.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                unsigned short r = (unsigned short)((src[i*4]*31 + 127)/255);
+                unsigned short g = (unsigned short)((src[i*4 + 1]*63 + 127)/255);
+                unsigned short b = (unsigned short)((src[i*4 + 2]*31 + 127)/255);
+
+                dst[i] = r << 11 | g << 5 | b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                unsigned short r = (unsigned short)((src[i*4]*31 + 127)/255);
+                unsigned short g = (unsigned short)((src[i*4 + 1]*31 + 127)/255);
+                unsigned short b = (unsigned short)((src[i*4 + 2]*31 + 127)/255);
+                unsigned short a = (src[i*4 + 3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+
+                dst[i] = r << 11 | g << 6 | b << 1 | a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                unsigned short r = (unsigned short)((src[i*4]*15 + 127)/255);
+                unsigned short g = (unsigned short)((src[i*4 + 1]*15 + 127)/255);
+                unsigned short b = (unsigned short)((src[i*4 + 2]*15 + 127)/255);
+                unsigned short a = (unsigned short)((src[i*4 + 3]*15 + 127)/255);
+
+                dst[i] = r << 12 | g << 8 | b << 4 | a;
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Image job: convert 16bit packed formats to RGBA 8bit (rows range)
+// NOTE: c*255/max matches (unsigned char)(c*(1.0f/max)*255.0f) used by normalized path
+static void ImageConvert16bitToRGBAJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned short *src = (const unsigned short *)job->image.data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+
+    switch (job->image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                dst[i*4] = (unsigned char)(((src[i] >> 11) & 0x1f)*255/31);
+                dst[i*4 + 1] = (unsigned char)(((src[i] >> 5) & 0x3f)*255/63);
+                dst[i*4 + 2] = (unsigned char)((src[i] & 0x1f)*255/31);
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                dst[i*4] = (unsigned char)(((src[i] >> 11) & 0x1f)*255/31);
+                dst[i*4 + 1] = (unsigned char)(((src[i] >> 6) & 0x1f)*255/31);
+                dst[i*4 + 2] = (unsigned char)(((src[i] >> 1) & 0x1f)*255/31);
+                dst[i*4 + 3] = (unsigned char)((src[i] & 0x1)*255);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = start*job->image.width; i < end*job->image.width; i++)
+            {
+                dst[i*4] = (unsigned char)(((src[i] >> 12) & 0xf)*255/15);
+                dst[i*4 + 1] = (unsigned char)(((src[i] >> 8) & 0xf)*255/15);
+                dst[i*4 + 2] = (unsigned char)(((src[i] >> 4) & 0xf)*255/15);
+                dst[i*4 + 3] = (unsigned char)((src[i] & 0xf)*255/15);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Image job: convert RGB/RGBA 8bit to 32bit or 16bit float with same components (rows range)
+static void ImageConvert8bitToFloatJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    const unsigned char *src = (const unsigned char *)job->image.data;
+    int components = GetPixelComponents(job->image.format);
+
+    if ((job->target.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (job->target.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        float *dst = (float *)job->target.data;
+
+        for (int i = start*job->image.width*components; i < end*job->image.width*components; i++) dst[i] = (float)src[i]/255.0f;
+    }
+    else
+    {
+        unsigned short *dst = (unsigned short *)job->target.data;
+
+        for (int i = start*job->image.width*components; i < end*job->image.width*components; i++) dst[i] = rlFloatToHalf((float)src[i]/255.0f);
+    }
+}
+
+// Image job: convert 32bit or 16bit float to RGB/RGBA 8bit with same components (rows range)
+static void ImageConvertFloatTo8bitJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    unsigned char *dst = (unsigned char *)job->target.data;
+    int components = GetPixelComponents(job->image.format);
+
+    if ((job->image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (job->image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        const float *src = (const float *)job->image.data;
+
+        for (int i = start*job->image.width*components; i < end*job->image.width*components; i++) dst[i] = (unsigned char)(src[i]*255.0f);
+    }
+    else
+    {
+        const unsigned short *src = (const unsigned short *)job->image.data;
+
+        for (int i = start*job->image.width*components; i < end*job->image.width*components; i++) dst[i] = (unsigned char)(rlHalfToFloat(src[i])*255.0f);
+    }
+}
+
+// Get direct pixel format converter job, NULL if conversion requires normalized pixels data
+// NOTE: Converters work on data directly (no intermediate float pixels), rows are independent
+static ParallelJobCallback GetImageFormatConverter(int format, int newFormat)
+{
+    static const ImageFormatConverter converters[] = {
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ImageConvertRGBAToRGBJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvertRGBToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, ImageConvertRGBAToGrayJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, ImageConvertRGBAToGrayJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, ImageConvertRGBAToGrayJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, ImageConvertRGBAToGrayJob },
+        { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvertGrayToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvertGrayToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R5G6B5, ImageConvertRGBATo16bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, ImageConvertRGBATo16bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, ImageConvertRGBATo16bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvert16bitToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvert16bitToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvert16bitToRGBAJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, ImageConvert8bitToFloatJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R32G32B32, ImageConvert8bitToFloatJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, ImageConvert8bitToFloatJob },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R16G16B16, ImageConvert8bitToFloatJob },
+        { PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvertFloatTo8bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ImageConvertFloatTo8bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ImageConvertFloatTo8bitJob },
+        { PIXELFORMAT_UNCOMPRESSED_R16G16B16, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ImageConvertFloatTo8bitJob },
+    };
+
+    for (int i = 0; i < (int)(sizeof(converters)/sizeof(converters[0])); i++)
+    {
+        if ((converters[i].format == format) && (converters[i].newFormat == newFormat)) return converters[i].job;
+    }
+
+    return NULL;
+}
+
+// Resize image data (8 bit per channel), output rows are split across jobs for big images
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int splits = 1;
+    if (((width*height) >= IMAGE_PARALLEL_MIN_PIXELS) || ((newWidth*newHeight) >= IMAGE_PARALLEL_MIN_PIXELS))
+    {
+        splits = stbir_build_samplers_with_splits(&resize, (rlGetJobWorkerCount() + 1)*2);
+    }
+
+    if (splits > 1)
+    {
+        ImageJob job = { 0 };
+        job.resize = &resize;
+        job.splitStarts = (int *)RL_MALLOC((splits + 1)*sizeof(int));
+
+        // NOTE: Every splits group computes its own output rows, result does not depend on splits count
+        int groups = GetResizeSplitStarts(&resize, splits, job.splitStarts);
+        RunParallelFor(ImageResizeJob, &job, groups);
+
+        RL_FREE(job.splitStarts);
+    }
+    else stbir_resize_extended(&resize);
+
+    stbir_free_samplers(&resize);
+}
+
+// Image job: resize image splits groups range
+static void ImageResizeJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+
+    for (int i = start; i < end; i++) stbir_resize_extended_split(job->resize, job->splitStarts[i], job->splitStarts[i + 1] - job->splitStarts[i]);
+}
+
+// Get resize splits groups safe to run independently, returns groups count
+// NOTE: stb_image_resize2 gather loop starts a split ring buffer at its first row lowest input scanline,
+// but rows input scanlines are not monotonic (leading zero coefficients are trimmed), so a group only starts
+// at a split whose first row scanline is the lowest of all following rows, other splits run with previous group
+static int GetResizeSplitStarts(STBIR_RESIZE *resize, int splits, int *splitStarts)
+{
+    stbir__info *info = (stbir__info *)resize->samplers;
+    int groups = 0;
+
+    if (info->vertical.is_gather)
+    {
+        // Mark valid group starts walking rows backwards (lowest input scanline of following rows)
+        int minScanline = info->vertical.contributors[info->split_info[splits - 1].end_output_y - 1].n0;
+
+        for (int i = splits - 1; i >= 0; i--)
+        {
+            int startRow = info->split_info[i].start_output_y;
+
+            for (int y = info->split_info[i].end_output_y - 1; y >= startRow; y--)
+            {
+                if (info->vertical.contributors[y].n0 < minScanline) minScanline = info->vertical.contributors[y].n0;
+            }
+
+            splitStarts[i] = (info->vertical.contributors[startRow].n0 <= minScanline);
+        }
+
+        for (int i = 0; i < splits; i++) if ((i == 0) || splitStarts[i]) splitStarts[groups++] = i;
+    }
+    else for (int i = 0; i < splits; i++) splitStarts[groups++] = i;
+
+    splitStarts[groups] = splits;
+
+    return groups;
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image job: premultiply alpha and box blur rows (rows range)
+static void ImageBlurRowsJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    unsigned char *line = (unsigned char *)RL_MALLOC(image.width*4);
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = (unsigned char *)(job->colors + y*image.width);
+
+        for (int i = 0; i < image.width*4; i += 4)
+        {
+            unsigned int alpha = row[i + 3];
+
+            row[i] = (unsigned char)((row[i]*alpha + 127)/255);
+            row[i + 1] = (unsigned char)((row[i + 1]*alpha + 127)/255);
+            row[i + 2] = (unsigned char)((row[i + 2]*alpha + 127)/255);
+        }
+
+        // Blur passes alternate between row and line buffer
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            if (i%2 == 0) BlurImageLine(row, 4, line, 4, image.width, 4, job->size);
+            else BlurImageLine(line, 4, row, 4, image.width, 4, job->size);
+        }
+
+        if ((GAUSSIAN_BLUR_ITERATIONS%2) != 0) memcpy(row, line, image.width*4);
+    }
+
+    RL_FREE(line);
+}
+
+// Image job: box blur columns tiles and reverse alpha premultiply (tiles range)
+// NOTE: Tile columns are blurred together, every tile row is a contiguous memory block
+static void ImageBlurColumnsJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    unsigned char *tile = (unsigned char *)RL_MALLOC(image.height*IMAGE_BLUR_TILE_WIDTH*4);
+
+    for (int t = start; t < end; t++)
+    {
+        int tileX = t*IMAGE_BLUR_TILE_WIDTH;
+        int tileWidth = ((tileX + IMAGE_BLUR_TILE_WIDTH) <= image.width)? IMAGE_BLUR_TILE_WIDTH : image.width - tileX;
+        unsigned char *columns = (unsigned char *)(job->colors + tileX);
+
+        // Blur passes alternate between image columns and tile buffer
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            if (i%2 == 0) BlurImageLine(columns, image.width*4, tile, tileWidth*4, image.height, tileWidth*4, job->size);
+            else BlurImageLine(tile, tileWidth*4, columns, image.width*4, image.height, tileWidth*4, job->size);
+        }
+
+        for (int y = 0; y < image.height; y++)
+        {
+            unsigned char *pixel = columns + y*image.width*4;
+            if ((GAUSSIAN_BLUR_ITERATIONS%2) != 0) memcpy(pixel, tile + y*tileWidth*4, tileWidth*4);
+
+            // Reverse premultiply
+            for (int i = 0; i < tileWidth*4; i += 4)
+            {
+                unsigned int alpha = pixel[i + 3];
+
+                if (alpha == 0)
+                {
+                    pixel[i] = 0;
+                    pixel[i + 1] = 0;
+                    pixel[i + 2] = 0;
+                }
+                else if (alpha < 255)
+                {
+                    pixel[i] = (unsigned char)((pixel[i] >= alpha)? 255 : (pixel[i]*255 + alpha/2)/alpha);
+                    pixel[i + 1] = (unsigned char)((pixel[i + 1] >= alpha)? 255 : (pixel[i + 1]*255 + alpha/2)/alpha);
+                    pixel[i + 2] = (unsigned char)((pixel[i + 2] >= alpha)? 255 : (pixel[i + 2]*255 + alpha/2)/alpha);
+                }
+            }
+        }
+    }
+
+    RL_FREE(tile);
+}
+
+// Box blur a line of elements (pixels or tile rows), every element byte (lane) is blurred independently
+// Running sums over window [x - radius, x + radius] (clipped to line), averaged in fixed point
+// NOTE: Division by window size is done with a 23 bit reciprocal, exact for windows up to 185 elements
+static void BlurImageLine(const unsigned char *src, int srcStride, unsigned char *dst, int dstStride, int length, int lanes, int radius)
+{
+    unsigned int sums[IMAGE_BLUR_TILE_WIDTH*4] = { 0 };
+    unsigned int count = 0;
+
+    for (int x = 0; (x <= radius) && (x < length); x++, count++)
+    {
+        for (int k = 0; k < lanes; k++) sums[k] += src[x*srcStride + k];
+    }
+
+    unsigned int recip = ((1u << 23) + count - 1)/count;
+
+    for (int x = 0; x < length; x++)
+    {
+        for (int k = 0; k < lanes; k++)
+        {
+            unsigned int value = ((sums[k] + count/2)*recip) >> 23;
+            dst[x*dstStride + k] = (unsigned char)((value > 255)? 255 : value);
+        }
+
+        bool resized = false;
+
+        if ((x - radius) >= 0)
+        {
+            for (int k = 0; k < lanes; k++) sums[k] -= src[(x - radius)*srcStride + k];
+            count--;
+            resized = !resized;
+        }
+
+        if ((x + radius + 1) < length)
+        {
+            for (int k = 0; k < lanes; k++) sums[k] += src[(x + radius + 1)*srcStride + k];
+            count++;
+            resized = !resized;
+        }
+
+        if (resized && (count > 0)) recip = ((1u << 23) + count - 1)/count;
+    }
+}
+
+// Image job: kernel convolution (rows range)
+// NOTE: Kernel products are accumulated in kernel order, out of image products are zero
+static void ImageKernelConvolutionJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    const rlColor *pixels = job->colors;
+    rlColor *output = job->output;
+    const float *kernel = job->kernel;
+    int kernelWidth = job->size;
+
+    int startRange = -kernelWidth/2;
+    int endRange = (kernelWidth%2 == 0)? kernelWidth/2 : kernelWidth/2 + 1;
+
+    for (int x = start; x < end; x++)
+    {
+        for (int y = 0; y < image.width; y++)
+        {
+            float rRes = 0.0f;
+            float gRes = 0.0f;
+            float bRes = 0.0f;
+            float aRes = 0.0f;
+
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    unsigned int imgindex = image.width*(x + xk) + (y + yk);
+
+                    if (imgindex < (unsigned int)(image.width*image.height))
+                    {
+                        rRes += ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        gRes += ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        bRes += ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        aRes += ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
+
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
+
+            if (rRes > 1.0f) rRes = 1.0f;
+            if (gRes > 1.0f) gRes = 1.0f;
+            if (bRes > 1.0f) bRes = 1.0f;
+
+            output[image.width*x + y].r = (unsigned char)(rRes*255.0f);
+            output[image.width*x + y].g = (unsigned char)(gRes*255.0f);
+            output[image.width*x + y].b = (unsigned char)(bRes*255.0f);
+            output[image.width*x + y].a = (unsigned char)(aRes*255.0f);
+        }
+    }
+}
+
+// Image job: dither image tiles for current wavefront step (tiles rows range)
+static void ImageDitherJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+
+    for (int r = job->offset + start; r < job->offset + end; r++)
+    {
+        int c = job->step - 2*r;
+
+        for (int j = 0; j < IMAGE_DITHER_TILE_HEIGHT; j++)
+        {
+            int y = r*IMAGE_DITHER_TILE_HEIGHT + j;
+            if (y >= image.height) break;
+
+            int x0 = c*IMAGE_DITHER_TILE_WIDTH - j;
+            int x1 = x0 + IMAGE_DITHER_TILE_WIDTH;
+            if (x0 < 0) x0 = 0;
+            if (x1 > image.width) x1 = image.width;
+
+            for (int x = x0; x < x1; x++) DitherImagePixel(job, x, y);
+        }
+    }
+}
+
+// Dither image pixel and diffuse quantization error to neighbour pixels (Floyd-Steinberg)
+static void DitherImagePixel(ImageJob *job, int x, int y)
+{
+    rlImage image = job->image;
+    rlColor *pixels = job->colors;
+    int rBpp = job->bpp[0];
+    int gBpp = job->bpp[1];
+    int bBpp = job->bpp[2];
+    int aBpp = job->bpp[3];
+
+    rlColor oldPixel = pixels[y*image.width + x];
+    rlColor newPixel = WHITE;
+
+    // NOTE: New pixel obtained by bits truncate, it would be better to round values (check rlImageFormat())
+    newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+    newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+    newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+    newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+
+    // NOTE: Error must be computed between new and old pixel but using same number of bits!
+    // We want to know how much color precision we have lost...
+    int rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+    int gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+    int bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+    pixels[y*image.width + x] = newPixel;
+
+    // NOTE: Some cases are out of the array and should be ignored
+    if (x < (image.width - 1))
+    {
+        pixels[y*image.width + x+1].r = MIN((int)pixels[y*image.width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+        pixels[y*image.width + x+1].g = MIN((int)pixels[y*image.width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+        pixels[y*image.width + x+1].b = MIN((int)pixels[y*image.width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+    }
+
+    if ((x > 0) && (y < (image.height - 1)))
+    {
+        pixels[(y+1)*image.width + x-1].r = MIN((int)pixels[(y+1)*image.width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+        pixels[(y+1)*image.width + x-1].g = MIN((int)pixels[(y+1)*image.width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+        pixels[(y+1)*image.width + x-1].b = MIN((int)pixels[(y+1)*image.width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+    }
+
+    if (y < (image.height - 1))
+    {
+        pixels[(y+1)*image.width + x].r = MIN((int)pixels[(y+1)*image.width + x].r + (int)((float)rError*5.0f/16), 0xff);
+        pixels[(y+1)*image.width + x].g = MIN((int)pixels[(y+1)*image.width + x].g + (int)((float)gError*5.0f/16), 0xff);
+        pixels[(y+1)*image.width + x].b = MIN((int)pixels[(y+1)*image.width + x].b + (int)((float)bError*5.0f/16), 0xff);
+    }
+
+    if ((x < (image.width - 1)) && (y < (image.height - 1)))
+    {
+        pixels[(y+1)*image.width + x+1].r = MIN((int)pixels[(y+1)*image.width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+        pixels[(y+1)*image.width + x+1].g = MIN((int)pixels[(y+1)*image.width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+        pixels[(y+1)*image.width + x+1].b = MIN((int)pixels[(y+1)*image.width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+    }
+
+    unsigned short rPixel = (unsigned short)newPixel.r;
+    unsigned short gPixel = (unsigned short)newPixel.g;
+    unsigned short bPixel = (unsigned short)newPixel.b;
+    unsigned short aPixel = (unsigned short)newPixel.a;
+
+    ((unsigned short *)image.data)[y*image.width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+}
+
+// Image job: tint colors (rows range)
+static void ImageColorTintJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    rlColor *pixels = job->colors;
+    rlColor color = job->color;
+
+    for (int i = start*image.width; i < end*image.width; i++)
+    {
+        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+
+        pixels[i].r = r;
+        pixels[i].g = g;
+        pixels[i].b = b;
+        pixels[i].a = a;
+    }
+}
+
+// Image job: adjust colors contrast (rows range)
+static void ImageColorContrastJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    rlColor *pixels = job->colors;
+    float contrast = job->contrast;
+
+    for (int i = start*image.width; i < end*image.width; i++)
+    {
+        float pR = (float)pixels[i].r/255.0f;
+        pR -= 0.5f;
+        pR *= contrast;
+        pR += 0.5f;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[i].g/255.0f;
+        pG -= 0.5f;
+        pG *= contrast;
+        pG += 0.5f;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[i].b/255.0f;
+        pB -= 0.5f;
+        pB *= contrast;
+        pB += 0.5f;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[i].r = (unsigned char)pR;
+        pixels[i].g = (unsigned char)pG;
+        pixels[i].b = (unsigned char)pB;
+    }
+}
+
+// Image job: adjust colors brightness (rows range)
+static void ImageColorBrightnessJob(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    rlImage image = job->image;
+    rlColor *pixels = job->colors;
+    int brightness = job->brightness;
+
+    for (int i = start*image.width; i < end*image.width; i++)
+    {
+        int cR = pixels[i].r + brightness;
+        int cG = pixels[i].g + brightness;
+        int cB = pixels[i].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[i].r = (unsigned char)cR;
+        pixels[i].g = (unsigned char)cG;
+        pixels[i].b = (unsigned char)cB;
+    }
+}
+#endif
+
+// Image job: draw source image rectangle into destination image (destination rows range)
+// NOTE: Every row is processed as colors lines: source line (scaled if required) blended into destination line
+static void ImageDrawRowsJob(void *data, int start, int end)
+{
+    ImageDrawJob *job = (ImageDrawJob *)data;
+    rlImage dst = job->dst;
+    rlImage src = job->src;
+    int count = job->endX - job->startX;
+    bool scaled = (job->srcWidth != job->dstWidth) || (job->srcHeight != job->dstHeight);
+
+    rlColor *srcColors = (rlColor *)RL_MALLOC(count*sizeof(rlColor));
+    rlColor *dstColors = (dst.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (rlColor *)RL_MALLOC(count*sizeof(rlColor)) : NULL;
+    rlColor *srcRows = NULL;            // Scaling: two source rows colors (source not RGBA 8bit)
+    int *columns = NULL;                // Scaling: source column (x0) and bilinear weight (8 bit) per destination column
+
+    if (scaled)
+    {
+        if (src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) srcRows = (rlColor *)RL_MALLOC(job->srcWidth*2*sizeof(rlColor));
+        columns = (int *)RL_MALLOC(count*2*sizeof(int));
+
+        for (int i = 0; i < count; i++)
+        {
+            GetImageDrawSample(job->startX - job->dstX + i, job->dstWidth, job->srcWidth, &columns[i*2], &columns[i*2 + 1]);
+        }
+    }
+
+    for (int y = job->startY + start; y < job->startY + end; y++)
+    {
+        const rlColor *srcLine = srcColors;
+        rlColor *dstLine = (dstColors != NULL)? dstColors : (rlColor *)dst.data + y*dst.width + job->startX;
+        int v = y - job->dstY;
+
+        if (!scaled)
+        {
+            // Fast path: Same format and no blend required, direct line copy
+            if (!job->blend && (src.format == dst.format))
+            {
+                int bytesPerPixel = GetPixelDataSize(1, 1, dst.format);
+                memcpy((unsigned char *)dst.data + (y*dst.width + job->startX)*bytesPerPixel,
+                    (unsigned char *)src.data + ((job->srcY + v)*src.width + job->srcX + job->startX - job->dstX)*bytesPerPixel, count*bytesPerPixel);
+                continue;
+            }
+
+            if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) srcLine = (rlColor *)src.data + (job->srcY + v)*src.width + job->srcX + job->startX - job->dstX;
+            else LoadImageLineColors(src, job->srcX + job->startX - job->dstX, job->srcY + v, count, srcColors);
+        }
+        else
+        {
+            int y0 = 0, wy = 0;
+            GetImageDrawSample(v, job->dstHeight, job->srcHeight, &y0, &wy);
+            int y1 = (y0 < (job->srcHeight - 1))? y0 + 1 : y0;
+
+            const rlColor *row0 = NULL;
+            const rlColor *row1 = NULL;
+
+            if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                row0 = (rlColor *)src.data + (job->srcY + y0)*src.width + job->srcX;
+                row1 = (rlColor *)src.data + (job->srcY + y1)*src.width + job->srcX;
+            }
+            else
+            {
+                LoadImageLineColors(src, job->srcX, job->srcY + y0, job->srcWidth, srcRows);
+                LoadImageLineColors(src, job->srcX, job->srcY + y1, job->srcWidth, srcRows + job->srcWidth);
+                row0 = srcRows;
+                row1 = srcRows + job->srcWidth;
+            }
+
+            // Bilinear filtering, colors are weighted by alpha to avoid transparent pixels color bleeding
+            for (int i = 0; i < count; i++)
+            {
+                int x0 = columns[i*2];
+                int x1 = (x0 < (job->srcWidth - 1))? x0 + 1 : x0;
+                unsigned int wx = columns[i*2 + 1];
+
+                unsigned int w00 = ((256 - wx)*(256 - wy))*row0[x0].a;
+                unsigned int w01 = (wx*(256 - wy))*row0[x1].a;
+                unsigned int w10 = ((256 - wx)*wy)*row1[x0].a;
+                unsigned int w11 = (wx*wy)*row1[x1].a;
+                unsigned int alpha = w00 + w01 + w10 + w11;
+
+                if (alpha == 0) srcColors[i] = (rlColor){ 0, 0, 0, 0 };
+                else
+                {
+                    srcColors[i].r = (unsigned char)((w00*row0[x0].r + w01*row0[x1].r + w10*row1[x0].r + w11*row1[x1].r + alpha/2)/alpha);
+                    srcColors[i].g = (unsigned char)((w00*row0[x0].g + w01*row0[x1].g + w10*row1[x0].g + w11*row1[x1].g + alpha/2)/alpha);
+                    srcColors[i].b = (unsigned char)((w00*row0[x0].b + w01*row0[x1].b + w10*row1[x0].b + w11*row1[x1].b + alpha/2)/alpha);
+                    srcColors[i].a = (unsigned char)((alpha + 32768) >> 16);
+                }
+            }
+        }
+
+        if (dstColors != NULL) LoadImageLineColors(dst, job->startX, y, count, dstColors);
+
+        if (job->blend) BlendImageLine(dstLine, srcLine, count, job->tint);
+        else memcpy(dstLine, srcLine, count*sizeof(rlColor));
+
+        if (dstColors != NULL) SetImageLineColors(dst, job->startX, y, count, dstColors);
+    }
+
+    RL_FREE(srcColors);
+    RL_FREE(dstColors);
+    RL_FREE(srcRows);
+    RL_FREE(columns);
+}
+
+// Get source sample position for destination position when scaling (pixels centers aligned)
+// NOTE: Returns first source position and bilinear weight of next one (8 bit fixed point)
+static void GetImageDrawSample(int position, int dstSize, int srcSize, int *sample, int *weight)
+{
+    long long fixed = ((long long)(2*position + 1)*srcSize*128)/dstSize - 128;
+
+    if (fixed < 0) fixed = 0;
+    if (fixed > (long long)(srcSize - 1)*256) fixed = (long long)(srcSize - 1)*256;
+
+    *sample = (int)(fixed >> 8);
+    *weight = (int)(fixed & 0xff);
+}
+
+// Load colors line from image data, count pixels from (x, y) position
+static void LoadImageLineColors(rlImage image, int x, int y, int count, rlColor *colors)
+{
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(colors, (rlColor *)image.data + y*image.width + x, count*sizeof(rlColor)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            const unsigned char *pixels = (unsigned char *)image.data + (y*image.width + x)*3;
+
+            for (int i = 0; i < count; i++) colors[i] = (rlColor){ pixels[i*3], pixels[i*3 + 1], pixels[i*3 + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            const unsigned char *pixels = (unsigned char *)image.data + y*image.width + x;
+
+            for (int i = 0; i < count; i++) colors[i] = (rlColor){ pixels[i], pixels[i], pixels[i], 255 };
+        } break;
+        default:
+        {
+            int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+            unsigned char *pixels = (unsigned char *)image.data + (y*image.width + x)*bytesPerPixel;
+
+            for (int i = 0; i < count; i++) colors[i] = rlGetPixelColor(pixels + i*bytesPerPixel, image.format);
+        } break;
+    }
+}
+
+// Set colors line into image data, count pixels from (x, y) position
+static void SetImageLineColors(rlImage image, int x, int y, int count, const rlColor *colors)
+{
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy((rlColor *)image.data + y*image.width + x, colors, count*sizeof(rlColor)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *pixels = (unsigned char *)image.data + (y*image.width + x)*3;
+
+            for (int i = 0; i < count; i++)
+            {
+                pixels[i*3] = colors[i].r;
+                pixels[i*3 + 1] = colors[i].g;
+                pixels[i*3 + 2] = colors[i].b;
+            }
+        } break;
+        default:
+        {
+            int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+            unsigned char *pixels = (unsigned char *)image.data + (y*image.width + x)*bytesPerPixel;
+
+            for (int i = 0; i < count; i++) rlSetPixelColor(pixels + i*bytesPerPixel, colors[i], image.format);
+        } break;
+    }
+}
+
+// Blend colors line over destination colors line, same as rlColorAlphaBlend() for every pixel
+// NOTE: Fully transparent and opaque source pixels skip blending math (usual case for sprites)
+static void BlendImageLine(rlColor *dst, const rlColor *src, int count, rlColor tint)
+{
+    bool tinted = (tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255);
+
+    for (int i = 0; i < count; i++)
+    {
+        rlColor color = src[i];
+
+        if (tinted)
+        {
+            color.r = (unsigned char)(((unsigned int)color.r*((unsigned int)tint.r + 1)) >> 8);
+            color.g = (unsigned char)(((unsigned int)color.g*((unsigned int)tint.g + 1)) >> 8);
+            color.b = (unsigned char)(((unsigned int)color.b*((unsigned int)tint.b + 1)) >> 8);
+            color.a = (unsigned char)(((unsigned int)color.a*((unsigned int)tint.a + 1)) >> 8);
+        }
+
+        if (color.a == 255) dst[i] = color;
+        else if (color.a > 0)
+        {
+            unsigned int alpha = (unsigned int)color.a + 1;
+            unsigned int dstAlpha = dst[i].a;
+            unsigned int outAlpha = (alpha*256 + dstAlpha*(256 - alpha)) >> 8;
+
+            // NOTE: outAlpha is never 0 here, source alpha is at least 1
+            dst[i].r = (unsigned char)((((unsigned int)color.r*alpha*256 + (unsigned int)dst[i].r*dstAlpha*(256 - alpha))/outAlpha) >> 8);
+            dst[i].g = (unsigned char)((((unsigned int)color.g*alpha*256 + (unsigned int)dst[i].g*dstAlpha*(256 - alpha))/outAlpha) >> 8);
+            dst[i].b = (unsigned char)((((unsigned int)color.b*alpha*256 + (unsigned int)dst[i].b*dstAlpha*(256 - alpha))/outAlpha) >> 8);
+            dst[i].a = (unsigned char)outAlpha;
+        }
+    }
+}
+
+// Get pixel format components count (channels), 1 for packed 16bit formats
+static int GetPixelComponents(int format)
+{
+    int components = 1;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: components = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: components = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: components = 4; break;
+        default: break;
+    }
+
+    return components;
+}
+
+// Run image job over count items (rows or columns), split in ranges across job system for big images
+// NOTE: Every item writes its own pixels, result does not depend on ranges split
+static void RunImageJob(ParallelJobCallback job, void *data, int count, int pixelCount)
+{
+    if (pixelCount >= IMAGE_PARALLEL_MIN_PIXELS) RunParallelFor(job, data, count);
+    else job(data, 0, count);
 }
 
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -49,12 +49,120 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+// Job system worker threads, not available on web without pthreads support
+#if !defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+    #define JOBS_THREADED
+#endif
+
+#if defined(JOBS_THREADED)
+    #if defined(_WIN32)
+        // Win32 threads functions (windows.h is not included to avoid conflicts)
+        typedef struct { void *ptr; } JobMutex;             // SRWLOCK
+        typedef struct { void *ptr; } JobCondition;         // CONDITION_VARIABLE
+        typedef void *JobThread;                            // HANDLE
+        #define JOB_MUTEX_INITIALIZER { 0 }
+        #define JOB_CONDITION_INITIALIZER { 0 }
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(JobMutex *lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(JobMutex *lock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(JobCondition *condition, JobMutex *lock, unsigned long ms, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(JobCondition *condition);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(JobCondition *condition);
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>                    // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()...
+        #include <unistd.h>                     // Required for: sysconf()
+        typedef pthread_mutex_t JobMutex;
+        typedef pthread_cond_t JobCondition;
+        typedef pthread_t JobThread;
+        #define JOB_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+        #define JOB_CONDITION_INITIALIZER PTHREAD_COND_INITIALIZER
+    #endif
+#endif
+
+// Memory mapped files, not available on web and android (assets are not plain files)
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+    #define FILEIO_MAPPED
+#endif
+
+#if defined(FILEIO_MAPPED)
+    #if defined(_WIN32)
+        // Win32 file mapping functions (windows.h is not included to avoid conflicts)
+        #define MAPPED_GENERIC_READ         0x80000000
+        #define MAPPED_FILE_SHARE_READ      0x00000001
+        #define MAPPED_OPEN_EXISTING        3
+        #define MAPPED_PAGE_READONLY        0x02
+        #define MAPPED_FILE_MAP_READ        0x0004
+        #define MAPPED_INVALID_HANDLE       ((void *)(long long)-1)
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *attributes, unsigned long creation, unsigned long flags, void *templateFile);
+        __declspec(dllimport) unsigned long __stdcall GetFileSize(void *file, unsigned long *fileSizeHigh);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    #else
+        #include <sys/mman.h>                   // Required for: mmap(), munmap()
+        #include <sys/stat.h>                   // Required for: fstat()
+        #include <fcntl.h>                      // Required for: open()
+        #include <unistd.h>                     // Required for: close()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_JOB_WORKERS
+    #define MAX_JOB_WORKERS              16         // Maximum job system worker threads
+#endif
+
+#define JOB_QUEUE_CAPACITY              256         // Job queue initial capacity (power of two, queues grow when full)
+#define JOB_RANGES_PER_THREAD             4         // Parallel-for ranges per thread, balances ranges with uneven cost
+
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+    long _InterlockedExchangeAdd(long volatile *addend, long value);
+    #pragma intrinsic(_InterlockedExchangeAdd)
+    #define ATOMIC_ADD(ptr, value) _InterlockedExchangeAdd((long volatile *)(ptr), (value))     // Returns previous value
+#else
+    #define THREAD_LOCAL __thread
+    #define ATOMIC_ADD(ptr, value) __atomic_fetch_add((ptr), (value), __ATOMIC_SEQ_CST)         // Returns previous value
+#endif
+#define ATOMIC_LOAD(ptr) ATOMIC_ADD(ptr, 0)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Job, queued until a thread runs it
+typedef struct Job {
+    JobCallback job;                    // Job function
+    void *data;                         // Job data
+    rlJobCounter *counter;              // Job counter, decremented when job is done (optional)
+} Job;
+
+// Job queue, a ring buffer of jobs [top, bottom)
+// NOTE: Owner thread pushes and pops jobs at bottom (LIFO), other threads steal jobs from top (FIFO)
+typedef struct JobQueue {
+    Job *jobs;                          // Jobs ring buffer
+    int capacity;                       // Jobs ring buffer capacity (power of two)
+    int top;                            // Oldest job position (next job stolen)
+    int bottom;                         // Newest job position + 1 (next job pushed)
+#if defined(JOBS_THREADED)
+    JobMutex mutex;                     // Queue mutex
+#endif
+} JobQueue;
+
+// Parallel-for range, run as a job
+typedef struct ParallelRange {
+    ParallelJobCallback job;            // Range function
+    void *data;                         // Range function data
+    int start;                          // Range first item
+    int end;                            // Range last item + 1
+} ParallelRange;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -66,6 +174,24 @@ static LoadFileDataCallback loadFileData = NULL;    // rlLoadFileData callback f
 static SaveFileDataCallback saveFileData = NULL;    // rlSaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // rlLoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // rlSaveFileText callback function pointer
+static ParallelForCallback parallelFor = NULL;      // RunParallelFor callback function pointer
+
+#if defined(JOBS_THREADED)
+static JobQueue jobQueues[MAX_JOB_WORKERS + 1] = { 0 }; // Job queues, one per worker, queue 0 is shared by non worker threads
+static JobThread jobWorkers[MAX_JOB_WORKERS] = { 0 };   // Job system worker threads
+static int jobWorkerCount = 0;                      // Job system worker threads running
+static int jobQueueCount = 0;                       // Job queues allocated (workers requested + 1)
+static bool jobSystemReady = false;                 // Job system initialized
+static bool jobsStop = false;                       // Job system workers stop requested (protected by jobs mutex)
+static int jobsPending = 0;                         // Jobs queued, not taken yet (atomic)
+static JobMutex jobsMutex = JOB_MUTEX_INITIALIZER;  // Jobs mutex, protects threads sleep and wake up
+static JobMutex jobsInitMutex = JOB_MUTEX_INITIALIZER; // Jobs init mutex, protects job system initialization (explicit or on first async job)
+static JobCondition jobsCondition = JOB_CONDITION_INITIALIZER; // Jobs condition, workers wait on it, signaled once per new job and on stop
+static JobCondition countersCondition = JOB_CONDITION_INITIALIZER; // Counters condition, counters waiters wait on it, signaled on counter jobs queued and done
+static THREAD_LOCAL int jobQueueIndex = 0;          // Current thread job queue (0 for non worker threads)
+
+static JobMutex asyncJobsMutex = JOB_MUTEX_INITIALIZER; // Async jobs mutex, protects data shared with async jobs
+#endif
 
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
@@ -75,6 +201,17 @@ void rlSetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = c
 void rlSetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void rlSetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void rlSetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
+void rlSetParallelForCallback(ParallelForCallback callback) { parallelFor = callback; }      // Set custom jobs dispatcher
+
+// Run job over items [0, count)
+// NOTE: Without custom dispatcher items are processed on job system (or on calling thread if not initialized)
+void RunParallelFor(ParallelJobCallback job, void *data, int count)
+{
+    if (count <= 0) return;
+
+    if (parallelFor != NULL) parallelFor(job, data, count);
+    else rlParallelFor(job, data, count);
+}
 
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
@@ -94,6 +231,21 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(JOBS_THREADED)
+static void PushJob(Job job);                       // Push job to current thread queue and wake up one worker
+static bool TakeJob(Job *job, rlJobCounter *counter); // Take job (of counter, if provided) from current thread queue or steal it from other queues
+static void WakeJobWorker(void);                    // Wake up one sleeping worker
+static void WakeJobWaiters(void);                   // Wake up sleeping counters waiters
+static void InitJobSystem(int workerCount);         // Initialize job system worker threads (jobs init mutex locked)
+#if defined(_WIN32)
+static unsigned long __stdcall JobWorkerThread(void *arg); // Job system worker thread: runs jobs until stop
+#else
+static void *JobWorkerThread(void *arg);            // Job system worker thread: runs jobs until stop
+#endif
+#endif
+static void RunJob(Job job);                        // Run job and decrement its counter
+static void RunParallelRange(void *data);           // Job: run parallel-for range
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -438,6 +590,294 @@ bool rlSaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Load file data mapped in memory (read-only), no data is copied until accessed
+// NOTE: Falls back to rlLoadFileData() if file mapping is not available or a custom file loader is set
+unsigned char *LoadFileMapped(const char *fileName, int *dataSize, bool *mapped)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+    *mapped = false;
+
+#if defined(FILEIO_MAPPED)
+    if ((fileName != NULL) && (loadFileData == NULL))
+    {
+    #if defined(_WIN32)
+        void *file = CreateFileA(fileName, MAPPED_GENERIC_READ, MAPPED_FILE_SHARE_READ, NULL, MAPPED_OPEN_EXISTING, 0, NULL);
+
+        if (file != MAPPED_INVALID_HANDLE)
+        {
+            unsigned long sizeHigh = 0;
+            unsigned long size = GetFileSize(file, &sizeHigh);
+
+            if ((size > 0) && (size <= 2147483647) && (sizeHigh == 0))
+            {
+                void *mapping = CreateFileMappingA(file, NULL, MAPPED_PAGE_READONLY, 0, 0, NULL);
+
+                if (mapping != NULL)
+                {
+                    data = (unsigned char *)MapViewOfFile(mapping, MAPPED_FILE_MAP_READ, 0, 0, 0);
+                    CloseHandle(mapping);   // NOTE: Mapped view keeps the mapping alive
+                }
+
+                if (data != NULL) *dataSize = (int)size;
+            }
+
+            CloseHandle(file);
+        }
+    #else
+        int file = open(fileName, O_RDONLY);
+
+        if (file != -1)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+            {
+                void *view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                if (view != MAP_FAILED)
+                {
+                    data = (unsigned char *)view;
+                    *dataSize = (int)info.st_size;
+                }
+            }
+
+            close(file);
+        }
+    #endif
+
+        if (data != NULL)
+        {
+            *mapped = true;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+            return data;
+        }
+    }
+#endif
+
+    data = rlLoadFileData(fileName, dataSize);
+
+    return data;
+}
+
+// Unload file data loaded by LoadFileMapped()
+void UnloadFileMapped(unsigned char *data, int dataSize, bool mapped)
+{
+    if (!mapped) rlUnloadFileData(data);
+#if defined(FILEIO_MAPPED)
+    #if defined(_WIN32)
+    else UnmapViewOfFile(data);
+    #else
+    else munmap(data, (size_t)dataSize);
+    #endif
+#endif
+}
+
+// Initialize job system worker threads, shared by library and user code
+// NOTE: workerCount 0 starts one worker per processor (calling thread excluded), at least one worker is started
+void rlInitJobSystem(int workerCount)
+{
+#if defined(JOBS_THREADED)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&jobsInitMutex);
+    InitJobSystem(workerCount);
+    ReleaseSRWLockExclusive(&jobsInitMutex);
+    #else
+    pthread_mutex_lock(&jobsInitMutex);
+    InitJobSystem(workerCount);
+    pthread_mutex_unlock(&jobsInitMutex);
+    #endif
+#else
+    TRACELOG(LOG_WARNING, "JOBS: Threads not supported, jobs run on calling thread");
+#endif
+}
+
+// Close job system, pending jobs are run before workers exit
+void rlCloseJobSystem(void)
+{
+#if defined(JOBS_THREADED)
+    if (!jobSystemReady) return;
+
+    // Jobs submitted from non worker threads are run by workers before exiting
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&jobsMutex);
+    jobsStop = true;
+    WakeAllConditionVariable(&jobsCondition);
+    ReleaseSRWLockExclusive(&jobsMutex);
+    #else
+    pthread_mutex_lock(&jobsMutex);
+    jobsStop = true;
+    pthread_cond_broadcast(&jobsCondition);
+    pthread_mutex_unlock(&jobsMutex);
+    #endif
+
+    for (int i = 0; i < jobWorkerCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(jobWorkers[i], 0xffffffff);
+        CloseHandle(jobWorkers[i]);
+    #else
+        pthread_join(jobWorkers[i], NULL);
+    #endif
+    }
+
+    // Run jobs left if no worker was started
+    Job job = { 0 };
+    while (TakeJob(&job, NULL)) RunJob(job);
+
+    for (int i = 0; i < jobQueueCount; i++)
+    {
+        RL_FREE(jobQueues[i].jobs);
+    #if !defined(_WIN32)
+        pthread_mutex_destroy(&jobQueues[i].mutex);
+    #endif
+        jobQueues[i] = (JobQueue){ 0 };
+    }
+
+    jobWorkerCount = 0;
+    jobQueueCount = 0;
+    jobsStop = false;
+    jobSystemReady = false;
+
+    TRACELOG(LOG_INFO, "JOBS: Job system closed successfully");
+#endif
+}
+
+// Check if job system is initialized
+bool rlIsJobSystemReady(void)
+{
+#if defined(JOBS_THREADED)
+    return jobSystemReady;
+#else
+    return false;
+#endif
+}
+
+// Get job system worker threads count
+int rlGetJobWorkerCount(void)
+{
+#if defined(JOBS_THREADED)
+    return jobWorkerCount;
+#else
+    return 0;
+#endif
+}
+
+// Run job on job system, counter (optional) is incremented until job is done
+// NOTE: Job runs on calling thread if job system is not initialized
+void rlRunJob(JobCallback job, void *data, rlJobCounter *counter)
+{
+    if (job == NULL) return;
+
+    if (counter != NULL) ATOMIC_ADD(&counter->value, 1);
+
+#if defined(JOBS_THREADED)
+    if (jobSystemReady) PushJob((Job){ job, data, counter });
+    else
+#endif
+    RunJob((Job){ job, data, counter });
+}
+
+// Wait for counter jobs to be done, calling thread runs pending jobs of that counter meanwhile
+// NOTE: Jobs depending on other jobs can wait their counters, waiting never blocks a worker,
+// other jobs (i.e. async loading) are never run by waiting threads, so waiting time is bounded by counter jobs
+void rlWaitJobCounter(rlJobCounter *counter)
+{
+    if (counter == NULL) return;
+
+#if defined(JOBS_THREADED)
+    Job job = { 0 };
+
+    while (ATOMIC_LOAD(&counter->value) > 0)
+    {
+        if (TakeJob(&job, counter)) RunJob(job);
+        else
+        {
+        #if defined(_WIN32)
+            AcquireSRWLockExclusive(&jobsMutex);
+            while ((ATOMIC_LOAD(&counter->value) > 0) && (ATOMIC_LOAD(&counter->queued) <= 0)) SleepConditionVariableSRW(&countersCondition, &jobsMutex, 0xffffffff, 0);
+            ReleaseSRWLockExclusive(&jobsMutex);
+        #else
+            pthread_mutex_lock(&jobsMutex);
+            while ((ATOMIC_LOAD(&counter->value) > 0) && (ATOMIC_LOAD(&counter->queued) <= 0)) pthread_cond_wait(&countersCondition, &jobsMutex);
+            pthread_mutex_unlock(&jobsMutex);
+        #endif
+        }
+    }
+#endif
+}
+
+// Process items [0, count) in ranges on job system, returns when all ranges are done
+// NOTE: Ranges split is deterministic for a given count and workers count, first range runs on calling thread
+void rlParallelFor(ParallelJobCallback job, void *data, int count)
+{
+    if (count <= 0) return;
+
+    int rangeCount = rlIsJobSystemReady()? (rlGetJobWorkerCount() + 1)*JOB_RANGES_PER_THREAD : 1;
+    if (rangeCount > count) rangeCount = count;
+
+    if (rangeCount <= 1)
+    {
+        job(data, 0, count);
+        return;
+    }
+
+    ParallelRange ranges[(MAX_JOB_WORKERS + 1)*JOB_RANGES_PER_THREAD] = { 0 };
+    rlJobCounter counter = { 0 };
+
+    for (int i = 0; i < rangeCount; i++)
+    {
+        ranges[i] = (ParallelRange){ job, data, (int)((long long)count*i/rangeCount), (int)((long long)count*(i + 1)/rangeCount) };
+        if (i > 0) rlRunJob(RunParallelRange, &ranges[i], &counter);
+    }
+
+    RunParallelRange(&ranges[0]);
+    rlWaitJobCounter(&counter);
+}
+
+// Run job on a job system worker, job system is initialized on first async job
+// NOTE: Lazy initialization is locked, threads running their first async job at the same time start only one job system
+void RunAsyncJob(JobCallback job, void *data)
+{
+#if defined(JOBS_THREADED)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&jobsInitMutex);
+    if (!jobSystemReady) InitJobSystem(0);
+    ReleaseSRWLockExclusive(&jobsInitMutex);
+    #else
+    pthread_mutex_lock(&jobsInitMutex);
+    if (!jobSystemReady) InitJobSystem(0);
+    pthread_mutex_unlock(&jobsInitMutex);
+    #endif
+#endif
+
+    rlRunJob(job, data, NULL);
+}
+
+// Lock async jobs mutex, shared data between jobs and other threads must be accessed with it locked
+void LockAsyncJobs(void)
+{
+#if defined(JOBS_THREADED)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&asyncJobsMutex);
+    #else
+    pthread_mutex_lock(&asyncJobsMutex);
+    #endif
+#endif
+}
+
+// Unlock async jobs mutex
+void UnlockAsyncJobs(void)
+{
+#if defined(JOBS_THREADED)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&asyncJobsMutex);
+    #else
+    pthread_mutex_unlock(&asyncJobsMutex);
+    #endif
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -508,3 +948,244 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+// Run job and decrement its counter, counters waiters are woken up when counter is done
+static void RunJob(Job job)
+{
+    job.job(job.data);
+
+    if ((job.counter != NULL) && (ATOMIC_ADD(&job.counter->value, -1) == 1))
+    {
+#if defined(JOBS_THREADED)
+        WakeJobWaiters();
+#endif
+    }
+}
+
+// Job: run parallel-for range
+static void RunParallelRange(void *data)
+{
+    ParallelRange *range = (ParallelRange *)data;
+
+    range->job(range->data, range->start, range->end);
+}
+
+#if defined(JOBS_THREADED)
+// Initialize job system worker threads, called with jobs init mutex locked
+static void InitJobSystem(int workerCount)
+{
+    if (jobSystemReady)
+    {
+        TRACELOG(LOG_WARNING, "JOBS: Job system already initialized");
+        return;
+    }
+
+    if (workerCount <= 0)
+    {
+    #if defined(_WIN32)
+        workerCount = (int)GetActiveProcessorCount(0xffff) - 1;
+    #else
+        workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    #endif
+    }
+
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
+    if (workerCount < 1) workerCount = 1;
+
+    for (int i = 0; i <= workerCount; i++)
+    {
+        jobQueues[i].jobs = (Job *)RL_MALLOC(JOB_QUEUE_CAPACITY*sizeof(Job));
+        jobQueues[i].capacity = JOB_QUEUE_CAPACITY;
+        jobQueues[i].top = 0;
+        jobQueues[i].bottom = 0;
+    #if !defined(_WIN32)
+        pthread_mutex_init(&jobQueues[i].mutex, NULL);
+    #endif
+    }
+
+    jobQueueCount = workerCount + 1;
+    jobSystemReady = true;
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        // NOTE: Worker queue index is passed as thread argument, queue 0 is not owned by workers
+    #if defined(_WIN32)
+        jobWorkers[jobWorkerCount] = CreateThread(NULL, 0, JobWorkerThread, (void *)(size_t)(jobWorkerCount + 1), 0, NULL);
+        if (jobWorkers[jobWorkerCount] != NULL) jobWorkerCount++;
+    #else
+        if (pthread_create(&jobWorkers[jobWorkerCount], NULL, JobWorkerThread, (void *)(size_t)(jobWorkerCount + 1)) == 0) jobWorkerCount++;
+    #endif
+    }
+
+    if (jobWorkerCount > 0) TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i workers)", jobWorkerCount);
+    else TRACELOG(LOG_WARNING, "JOBS: Failed to start job system workers, jobs run on waiting threads");
+}
+
+// Push job to current thread queue and wake up one worker (and counter waiters, if job has counter)
+static void PushJob(Job job)
+{
+    JobQueue *queue = &jobQueues[jobQueueIndex];
+
+    // NOTE: Jobs pending is incremented before job is available, so sleeping threads never miss it
+    ATOMIC_ADD(&jobsPending, 1);
+    if (job.counter != NULL) ATOMIC_ADD(&job.counter->queued, 1);
+
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&queue->mutex);
+#else
+    pthread_mutex_lock(&queue->mutex);
+#endif
+
+    if ((queue->bottom - queue->top) == queue->capacity)
+    {
+        // Queue is full, grow it keeping jobs positions
+        Job *jobs = (Job *)RL_MALLOC(queue->capacity*2*sizeof(Job));
+        for (int i = queue->top; i < queue->bottom; i++) jobs[i & (queue->capacity*2 - 1)] = queue->jobs[i & (queue->capacity - 1)];
+
+        RL_FREE(queue->jobs);
+        queue->jobs = jobs;
+        queue->capacity *= 2;
+    }
+
+    queue->jobs[queue->bottom & (queue->capacity - 1)] = job;
+    queue->bottom++;
+
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&queue->mutex);
+#else
+    pthread_mutex_unlock(&queue->mutex);
+#endif
+
+    WakeJobWorker();
+    if (job.counter != NULL) WakeJobWaiters();
+}
+
+// Take job from current thread queue (newest job) or steal it from other queues (oldest job)
+// NOTE: If counter is provided only jobs of that counter are taken, jobs order in queues is kept
+static bool TakeJob(Job *job, rlJobCounter *counter)
+{
+    if (ATOMIC_LOAD(&jobsPending) <= 0) return false;
+    if ((counter != NULL) && (ATOMIC_LOAD(&counter->queued) <= 0)) return false;
+
+    bool taken = false;
+
+    for (int i = 0; (i < jobQueueCount) && !taken; i++)
+    {
+        int index = (jobQueueIndex + i)%jobQueueCount;
+        JobQueue *queue = &jobQueues[index];
+        int mask = 0;
+
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&queue->mutex);
+    #else
+        pthread_mutex_lock(&queue->mutex);
+    #endif
+
+        mask = queue->capacity - 1;
+
+        if (i == 0)
+        {
+            // Own queue: search from newest job, jobs above taken one are moved down
+            for (int k = queue->bottom - 1; (k >= queue->top) && !taken; k--)
+            {
+                if ((counter != NULL) && (queue->jobs[k & mask].counter != counter)) continue;
+
+                *job = queue->jobs[k & mask];
+                for (int n = k; n < (queue->bottom - 1); n++) queue->jobs[n & mask] = queue->jobs[(n + 1) & mask];
+                queue->bottom--;
+                taken = true;
+            }
+        }
+        else
+        {
+            // Other queue: search from oldest job, jobs below taken one are moved up
+            for (int k = queue->top; (k < queue->bottom) && !taken; k++)
+            {
+                if ((counter != NULL) && (queue->jobs[k & mask].counter != counter)) continue;
+
+                *job = queue->jobs[k & mask];
+                for (int n = k; n > queue->top; n--) queue->jobs[n & mask] = queue->jobs[(n - 1) & mask];
+                queue->top++;
+                taken = true;
+            }
+        }
+
+    #if defined(_WIN32)
+        ReleaseSRWLockExclusive(&queue->mutex);
+    #else
+        pthread_mutex_unlock(&queue->mutex);
+    #endif
+    }
+
+    if (taken)
+    {
+        ATOMIC_ADD(&jobsPending, -1);
+        if (job->counter != NULL) ATOMIC_ADD(&job->counter->queued, -1);
+    }
+
+    return taken;
+}
+
+// Wake up one sleeping worker, one worker is signaled per job pushed
+static void WakeJobWorker(void)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&jobsMutex);
+    WakeConditionVariable(&jobsCondition);
+    ReleaseSRWLockExclusive(&jobsMutex);
+#else
+    pthread_mutex_lock(&jobsMutex);
+    pthread_cond_signal(&jobsCondition);
+    pthread_mutex_unlock(&jobsMutex);
+#endif
+}
+
+// Wake up sleeping counters waiters, every waiter checks its own counter
+static void WakeJobWaiters(void)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&jobsMutex);
+    WakeAllConditionVariable(&countersCondition);
+    ReleaseSRWLockExclusive(&jobsMutex);
+#else
+    pthread_mutex_lock(&jobsMutex);
+    pthread_cond_broadcast(&countersCondition);
+    pthread_mutex_unlock(&jobsMutex);
+#endif
+}
+
+// Job system worker thread: runs own jobs or steals jobs from other queues, sleeps if no jobs are pending
+// NOTE: Worker exits when stop is requested and no jobs are pending
+#if defined(_WIN32)
+static unsigned long __stdcall JobWorkerThread(void *arg)
+#else
+static void *JobWorkerThread(void *arg)
+#endif
+{
+    jobQueueIndex = (int)(size_t)arg;
+
+    Job job = { 0 };
+    bool stop = false;
+
+    while (!stop)
+    {
+        if (TakeJob(&job, NULL)) RunJob(job);
+        else
+        {
+        #if defined(_WIN32)
+            AcquireSRWLockExclusive(&jobsMutex);
+            while ((ATOMIC_LOAD(&jobsPending) <= 0) && !jobsStop) SleepConditionVariableSRW(&jobsCondition, &jobsMutex, 0xffffffff, 0);
+            stop = jobsStop && (ATOMIC_LOAD(&jobsPending) <= 0);
+            ReleaseSRWLockExclusive(&jobsMutex);
+        #else
+            pthread_mutex_lock(&jobsMutex);
+            while ((ATOMIC_LOAD(&jobsPending) <= 0) && !jobsStop) pthread_cond_wait(&jobsCondition, &jobsMutex);
+            stop = jobsStop && (ATOMIC_LOAD(&jobsPending) <= 0);
+            pthread_mutex_unlock(&jobsMutex);
+        #endif
+        }
+    }
+
+    return 0;
+}
+#endif
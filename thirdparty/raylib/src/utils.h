@@ -69,6 +69,13 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+unsigned char *LoadFileMapped(const char *fileName, int *dataSize, bool *mapped); // Load file data mapped in memory (or loaded with rlLoadFileData())
+void UnloadFileMapped(unsigned char *data, int dataSize, bool mapped);              // Unload file data loaded by LoadFileMapped()
+void RunParallelFor(ParallelJobCallback job, void *data, int count);  // Run job over items [0, count) with parallel-for callback (or job system)
+void RunAsyncJob(JobCallback job, void *data);                        // Run job on a job system worker (job system is initialized if required)
+void LockAsyncJobs(void);                                             // Lock async jobs mutex (data shared with async jobs)
+void UnlockAsyncJobs(void);                                           // Unlock async jobs mutex
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!